@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * 
+ * File:	MinesweeperBatch.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ * 
+ * Description: Implementation file for the MinesweeperBatch class. Plays a
+ *	large number of independent headless games spread across all cores.
+ *
+ *	Games are grouped into chunks. Each worker starts with an even share of 
+ *	the chunks as a range of chunk numbers and takes chunks from the front of
+ *	its own range. A worker that runs out steals the back half of another 
+ *	worker's range. Ranges are packed into one atomic word so taking and 
+ *	stealing never need a lock.
+ *
+ *	Every game is seeded from the batch seed and its game number, and results
+ *	are stored by chunk, so the totals for a seed are the same no matter how
+ *	many threads ran or who played which game. Phase times go into a 
+ *	histogram per worker, so memory doesn't grow with the number of games.
+ *	Histograms merge by adding counts, so the order doesn't matter.
+ * 
+ ******************************************************************************/
+#include <chrono>
+#include <thread>
+#include "MinesweeperBatch.hpp"
+#include "MinesweeperRandom.hpp"
+#include "MinesweeperSimulator.hpp"
+
+using std::vector;
+
+static uint64_t packRange(uint64_t, uint64_t);
+
+/**
+* 
+* MinesweeperBatch::MinesweeperBatch(int rows, int cols, int mines, 
+*		int threads) 
+* 
+* Summary: Constructor
+* 
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+*				int for the number of worker threads, 0 to use every core
+* 				
+**/
+MinesweeperBatch::MinesweeperBatch(int rows, int cols, int mines, int threads) 
+{
+	this->rows = rows;
+	this->cols = cols;
+	this->mines = mines;
+	this->threadCount = threads;
+	if (threadCount < 1) {
+		threadCount = std::thread::hardware_concurrency();
+	}
+	if (threadCount < 1) {
+		threadCount = 1;
+	}
+	safeOpening = false;
+	gameCount = 0;
+	baseSeed = 0;
+	chunkRanges = nullptr;
+}
+
+/**
+* 
+* MinesweeperBatch::~MinesweeperBatch() 
+* 
+* Summary: Destructor
+* 
+**/
+MinesweeperBatch::~MinesweeperBatch() 
+{
+
+}
+
+/**
+* 
+* void MinesweeperBatch::setSafeOpening(bool safeOpening) 
+* 
+* Summary: Sets whether the first reveal of every game is an opening
+* 
+* Parameters:	bool - true to place mines after the first reveal
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperBatch::setSafeOpening(bool safeOpening) 
+{
+	this->safeOpening = safeOpening;
+}
+
+/**
+* 
+* BatchResult MinesweeperBatch::run(long games, unsigned long seed)
+* 
+* Summary: Plays a batch of games on all worker threads
+* 
+* Parameters:	long for the number of games to play
+*				unsigned long for the batch seed
+* 				
+* Returns:	    BatchResult for the totals and phase time histograms
+*
+**/
+BatchResult MinesweeperBatch::run(long games, unsigned long seed)
+{
+	BatchResult batch;
+	long chunkCount = (games + GAMES_PER_CHUNK - 1) / GAMES_PER_CHUNK;
+	vector<std::atomic<uint64_t>> ranges(threadCount);
+
+	batch.games = games;
+	chunkWins.assign(chunkCount, 0);
+	chunkGuesses.assign(chunkCount, 0);
+	generateTimes.assign(threadCount, MinesweeperHistogram());
+	solveTimes.assign(threadCount, MinesweeperHistogram());
+	guessTimes.assign(threadCount, MinesweeperHistogram());
+	gameCount = games;
+	baseSeed = seed;
+	chunkRanges = &ranges;
+
+	// split the chunks evenly between the workers
+	for (int t = 0; t < threadCount; t++) {
+		ranges[t].store(packRange(chunkCount * t / threadCount, 
+				chunkCount * (t + 1) / threadCount));
+	}
+
+	std::chrono::steady_clock::time_point start = 
+			std::chrono::steady_clock::now();
+	vector<std::thread> threads;
+	for (int t = 1; t < threadCount; t++) {
+		threads.push_back(std::thread(&MinesweeperBatch::worker, this, t));
+	}
+	worker(0);
+	for (size_t t = 0; t < threads.size(); t++) {
+		threads[t].join();
+	}
+	batch.seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	// merge in chunk order, then worker order
+	batch.wins = 0;
+	batch.guesses = 0;
+	for (long c = 0; c < chunkCount; c++) {
+		batch.wins += chunkWins[c];
+		batch.guesses += chunkGuesses[c];
+	}
+	for (int t = 0; t < threadCount; t++) {
+		batch.generateTimes.merge(generateTimes[t]);
+		batch.solveTimes.merge(solveTimes[t]);
+		batch.guessTimes.merge(guessTimes[t]);
+	}
+
+	chunkRanges = nullptr;
+	generateTimes.clear();
+	solveTimes.clear();
+	guessTimes.clear();
+	return batch;
+}
+
+/**
+* 
+* void MinesweeperBatch::worker(int id)
+* 
+* Summary: Plays chunks of games until there are none left to take or steal
+* 
+* Parameters:	int for the worker number
+* 				
+* Returns:	    void
+*
+* Description: Each worker owns one simulator, so its board and solver 
+*	buffers are reused for every game it plays. Phase times are counted in
+*	the worker's own histograms, which are stored once it is done so 
+*	workers never write near each other while playing.
+*
+**/
+void MinesweeperBatch::worker(int id)
+{
+	MinesweeperSimulator simulator(rows, cols, mines);
+	MinesweeperHistogram generate, solve, guess;	// this worker's times
+	simulator.setParallel(false);	// the cores are already busy
+	simulator.setSafeOpening(safeOpening);
+	long chunk;
+
+	while (true) {
+		if (!takeChunk(id, chunk)) {
+			if (!stealChunks(id)) {
+				break;
+			}
+			continue;
+		}
+
+		long first = chunk * GAMES_PER_CHUNK;
+		long last = first + GAMES_PER_CHUNK;
+		if (last > gameCount) {
+			last = gameCount;
+		}
+
+		for (long game = first; game < last; game++) {
+			uint64_t seed = MinesweeperRandom::deriveSeed(baseSeed, game);
+			SimulationResult gameResult = simulator.playGame(seed);
+
+			if (gameResult.status == WIN) {
+				chunkWins[chunk] += 1;
+			}
+			chunkGuesses[chunk] += gameResult.guesses;
+			generate.add(gameResult.generateSeconds);
+			solve.add(gameResult.solveSeconds);
+			guess.add(gameResult.guessSeconds);
+		}
+	}
+
+	generateTimes[id] = generate;
+	solveTimes[id] = solve;
+	guessTimes[id] = guess;
+}
+
+/**
+* 
+* bool MinesweeperBatch::takeChunk(int id, long &chunk)
+* 
+* Summary: Takes the next chunk from the front of a worker's own range
+* 
+* Parameters:	int for the worker number
+*				long (reference) to store the chunk number
+* 				
+* Returns:	    bool - false if the worker's range is empty
+*
+**/
+bool MinesweeperBatch::takeChunk(int id, long &chunk)
+{
+	std::atomic<uint64_t> &range = (*chunkRanges)[id];
+	uint64_t current = range.load();
+
+	while (true) {
+		uint64_t begin = current >> 32, end = current & 0xffffffff;
+		if (begin >= end) {
+			return false;
+		}
+		if (range.compare_exchange_weak(current, packRange(begin + 1, end))) {
+			chunk = begin;
+			return true;
+		}
+	}
+}
+
+/**
+* 
+* bool MinesweeperBatch::stealChunks(int id)
+* 
+* Summary: Moves the back half of another worker's range to this worker
+* 
+* Parameters:	int for the worker number (its own range must be empty)
+* 				
+* Returns:	    bool - false if every other worker's range is empty
+*
+* Description: Only the victim's range is changed with compare and swap. The
+*	thief's own range is empty, so no other worker will touch it while the 
+*	stolen chunks are stored there.
+*
+**/
+bool MinesweeperBatch::stealChunks(int id)
+{
+	for (int offset = 1; offset < threadCount; offset++) {
+		std::atomic<uint64_t> &victim = 
+				(*chunkRanges)[(id + offset) % threadCount];
+		uint64_t current = victim.load();
+
+		while (true) {
+			uint64_t begin = current >> 32, end = current & 0xffffffff;
+			if (begin >= end) {
+				break;
+			}
+			uint64_t middle = end - (end - begin + 1) / 2;
+			if (victim.compare_exchange_weak(current, 
+					packRange(begin, middle))) {
+				(*chunkRanges)[id].store(packRange(middle, end));
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+* 
+* static uint64_t packRange(uint64_t begin, uint64_t end)
+* 
+* Summary: Packs a range of chunk numbers into one word
+* 
+* Parameters:	uint64_t for the first chunk in the range
+*				uint64_t for one past the last chunk
+* 				
+* Returns:	    uint64_t with begin in the high half and end in the low half
+*
+**/
+static uint64_t packRange(uint64_t begin, uint64_t end)
+{
+	return (begin << 32) | end;
+}
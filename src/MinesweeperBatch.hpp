@@ -0,0 +1,55 @@
+/*******************************************************************************
+* File:		MinesweeperBatch.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_BATCH_HPP
+#define MINESWEEPER_BATCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "MinesweeperHistogram.hpp"
+
+struct BatchResult
+{
+	long games;
+	long wins;
+	long guesses;
+	double seconds;						// wall clock time for the batch
+	MinesweeperHistogram generateTimes;	// phase times of every game
+	MinesweeperHistogram solveTimes;
+	MinesweeperHistogram guessTimes;
+};
+
+class MinesweeperBatch
+{
+	public:
+		MinesweeperBatch(int, int, int, int);
+		~MinesweeperBatch();
+
+		void setSafeOpening(bool);
+		BatchResult run(long, unsigned long);
+
+	private:
+		static const int GAMES_PER_CHUNK = 64;
+
+		int rows, cols, mines, threadCount;
+		bool safeOpening;
+
+		// state shared by the workers during a run
+		long gameCount;
+		unsigned long baseSeed;
+		std::vector<std::atomic<uint64_t>> *chunkRanges;	// one per worker
+		std::vector<long> chunkWins, chunkGuesses;
+		std::vector<MinesweeperHistogram> generateTimes;	// one per worker
+		std::vector<MinesweeperHistogram> solveTimes;
+		std::vector<MinesweeperHistogram> guessTimes;
+
+		// helper functions
+		void worker(int);
+		bool takeChunk(int, long &);
+		bool stealChunks(int);
+};
+
+#endif
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * 
+ * File:	MinesweeperBitboard.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ * 
+ * Description: Implementation file for the MinesweeperBitboard class. Stores
+ *	one bit per board cell, 64 cells to a word, so that whole board queries
+ *	and updates work on a word at a time.
+ * 
+ ******************************************************************************/
+#include <stddef.h>		// size_t
+#include "MinesweeperBitboard.hpp"
+
+/**
+* 
+* MinesweeperBitboard::MinesweeperBitboard() 
+* 
+* Summary: Constructor. Creates an empty bitboard, call resize before use.
+* 
+**/
+MinesweeperBitboard::MinesweeperBitboard() 
+{
+	size = 0;
+}
+
+/**
+* 
+* MinesweeperBitboard::~MinesweeperBitboard() 
+* 
+* Summary: Destructor
+* 
+**/
+MinesweeperBitboard::~MinesweeperBitboard() 
+{
+
+}
+
+/**
+* 
+* void MinesweeperBitboard::resize(int size)
+* 
+* Summary: Sets the number of cells in the bitboard and clears all bits
+* 
+* Parameters:	int for the number of cells
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperBitboard::resize(int size)
+{
+	this->size = size;
+	words.assign((size + WORD_BITS - 1) / WORD_BITS, 0);
+}
+
+/**
+* 
+* void MinesweeperBitboard::clear()
+* 
+* Summary: Clears all bits
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperBitboard::clear()
+{
+	for (size_t i = 0; i < words.size(); i++) {
+		words[i] = 0;
+	}
+}
+
+/**
+* 
+* void MinesweeperBitboard::setMasked(const MinesweeperBitboard &bits,
+*		const MinesweeperBitboard &mask)
+* 
+* Summary: Sets every bit that is set in bits and not set in mask
+* 
+* Parameters:	MinesweeperBitboard for the bits to set
+*				MinesweeperBitboard for the bits to leave alone
+* 				
+* Returns:	    void
+*
+* Description: this |= bits & ~mask. All bitboards must be the same size.
+*
+**/
+void MinesweeperBitboard::setMasked(const MinesweeperBitboard &bits,
+		const MinesweeperBitboard &mask)
+{
+	for (size_t i = 0; i < words.size(); i++) {
+		words[i] |= bits.words[i] & ~mask.words[i];
+	}
+}
+
+/**
+* 
+* void MinesweeperBitboard::setWords(const uint64_t *source)
+* 
+* Summary: Copies every bit from an array of words
+* 
+* Parameters:	uint64_t array of getWordCount words, see getWords
+* 				
+* Returns:	    void
+*
+* Description: Call resize first. Bits past the size in the last word are 
+*	ignored.
+*
+**/
+void MinesweeperBitboard::setWords(const uint64_t *source)
+{
+	for (size_t i = 0; i < words.size(); i++) {
+		words[i] = source[i];
+	}
+	if (size % WORD_BITS != 0) {
+		words.back() &= ~(~(uint64_t)0 << (size % WORD_BITS));
+	}
+}
+
+/**
+* 
+* int MinesweeperBitboard::count() const
+* 
+* Summary: Returns the number of bits that are set
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperBitboard::count() const
+{
+	int total = 0;
+
+	for (size_t i = 0; i < words.size(); i++) {
+		total += __builtin_popcountll(words[i]);
+	}
+	return total;
+}
+
+/**
+* 
+* bool MinesweeperBitboard::intersects(const MinesweeperBitboard &other) const
+* 
+* Summary: Checks if any bit is set in both bitboards
+* 
+* Parameters:	MinesweeperBitboard of the same size
+* 				
+* Returns:	    bool
+*
+**/
+bool MinesweeperBitboard::intersects(const MinesweeperBitboard &other) const
+{
+	for (size_t i = 0; i < words.size(); i++) {
+		if (words[i] & other.words[i]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+* 
+* int MinesweeperBitboard::nextSet(int idx) const
+* 
+* Summary: Finds the first set bit at or after a cell
+* 
+* Parameters:	int for the cell to start from
+* 				
+* Returns:	    int for the cell, or -1 if no later bit is set
+*
+* Description: Skips a word at a time, so walking every set bit costs about
+*	one step per set bit plus one per word.
+*
+**/
+int MinesweeperBitboard::nextSet(int idx) const
+{
+	if (idx >= size) {
+		return -1;
+	}
+
+	size_t word = idx / WORD_BITS;
+	uint64_t bits = words[word] & (~(uint64_t)0 << (idx % WORD_BITS));
+
+	while (bits == 0) {
+		if (++word == words.size()) {
+			return -1;
+		}
+		bits = words[word];
+	}
+	return word * WORD_BITS + __builtin_ctzll(bits);
+}
+
+/**
+* 
+* int MinesweeperBitboard::getSize() const
+* 
+* Summary: Returns the number of cells in the bitboard
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperBitboard::getSize() const
+{
+	return size;
+}
+
+/**
+* 
+* int MinesweeperBitboard::getWordCount() const
+* 
+* Summary: Returns the number of 64 bit words that hold the bits
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperBitboard::getWordCount() const
+{
+	return words.size();
+}
+
+/**
+* 
+* const uint64_t *MinesweeperBitboard::getWords() const
+* 
+* Summary: Returns the words that hold the bits
+* 
+* Parameters:	none
+* 				
+* Returns:	    uint64_t array of getWordCount words. Cell idx is bit 
+*				idx % 64 of word idx / 64.
+*
+**/
+const uint64_t *MinesweeperBitboard::getWords() const
+{
+	return words.data();
+}
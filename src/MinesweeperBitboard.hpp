@@ -0,0 +1,58 @@
+/*******************************************************************************
+* File:		MinesweeperBitboard.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_BITBOARD_HPP
+#define MINESWEEPER_BITBOARD_HPP
+
+#include <cstdint>
+#include <vector>
+
+class MinesweeperBitboard
+{
+	public:
+		MinesweeperBitboard();
+		~MinesweeperBitboard();
+
+		// setters
+		void resize(int);
+		void clear();
+		void set(int);
+		void reset(int);
+		void setMasked(const MinesweeperBitboard &, 
+				const MinesweeperBitboard &);
+		void setWords(const uint64_t *);
+
+		// getters
+		bool test(int) const;
+		int count() const;
+		bool intersects(const MinesweeperBitboard &) const;
+		int nextSet(int) const;
+		int getSize() const;
+		int getWordCount() const;
+		const uint64_t *getWords() const;
+
+	private:
+		static const int WORD_BITS = 64;
+
+		int size;
+		std::vector<uint64_t> words;
+};
+
+inline void MinesweeperBitboard::set(int idx)
+{
+	words[idx / WORD_BITS] |= (uint64_t)1 << (idx % WORD_BITS);
+}
+
+inline void MinesweeperBitboard::reset(int idx)
+{
+	words[idx / WORD_BITS] &= ~((uint64_t)1 << (idx % WORD_BITS));
+}
+
+inline bool MinesweeperBitboard::test(int idx) const
+{
+	return (words[idx / WORD_BITS] >> (idx % WORD_BITS)) & 1;
+}
+
+#endif
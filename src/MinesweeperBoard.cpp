@@ -6,121 +6,406 @@
  * 
  * Description: Implementation file for the MinesweeperBoard class. Contains 
  *	code that manages the player and solution game boards during minesweeper 
- *	gameplay.
+ *	gameplay. The solution board stores a char for each cell ('*' or '0'-'8').
+ *	The player board is stored as bitboards for mines, revealed cells and
+ *	flagged cells, and is converted to display chars only when it is read.
  * 
  ******************************************************************************/
 #include <stddef.h>		// size_t
+#include <cassert>
 #include "MinesweeperBoard.hpp"
-#include "minesweeperUtils.hpp"
+#include "MinesweeperBoardView.hpp"
+#include "MinesweeperSnapshot.hpp"
+#include "minesweeperHints.hpp"
+#include "minesweeperNeighbors.hpp"
+#include "minesweeperStats.hpp"
+#include "minesweeperTrace.hpp"
 
 using std::vector;
 using std::pair;
 
 /**
 * 
-* MinesweeperBoard::MinesweeperBoard(int rows, int cols, int mines) 
+* MinesweeperBoard::MinesweeperBoard(int rows, int cols, int mines, 
+*		uint64_t seed) 
 * 
 * Summary: Constructor
 * 
 * Parameters:	int for board rows
 *				int for board cols
 *				int for number of mines
+*				uint64_t for the seed used to place mines
 * 				
 **/
-MinesweeperBoard::MinesweeperBoard(int rows, int cols, int mines) 
+MinesweeperBoard::MinesweeperBoard(int rows, int cols, int mines, 
+		uint64_t seed) 
+{
+	safeOpening = false;
+	reset(rows, cols, mines, seed);
+}
+
+/**
+* 
+* MinesweeperBoard::~MinesweeperBoard() 
+* 
+* Summary: Destructor
+* 
+**/
+MinesweeperBoard::~MinesweeperBoard() 
+{
+
+}
+
+/**
+* 
+* void MinesweeperBoard::reset(int rows, int cols, int mines, uint64_t seed) 
+* 
+* Summary: Starts a new game on the board
+* 
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+*				uint64_t for the seed used to place mines
+* 				
+* Returns:	    void
+*
+* Description: Clears the board and places new mines. Buffers from the last 
+*	game are reused, so nothing is allocated unless the board grows. Any 
+*	MinesweeperSolver playing this board must be reset as well.
+*
+*	The board's random numbers (mine placement, random reveals and solver 
+*	guesses) all come from its own generator, so the same seed always plays
+*	the same game.
+*
+*	With a safe opening, mines are not placed until the first reveal.
+*
+**/
+void MinesweeperBoard::reset(int rows, int cols, int mines, uint64_t seed) 
 {
 	this->rows = rows;
 	this->cols = cols;
 	this->mines = this->flagsRemaining = mines;
+	this->stride = cols + 2;
+	this->revealedCount = 0;
+	this->mineHit = false;
+	this->flagEdits = 0;
+	this->seed = seed;
+	random.seed(seed);
 	
-	initializeVect(solutionBoard, rows, cols, '0');
-	initializeVect(playerBoard, rows, cols, '-');
-	setNeighborCellCoordinates();
-	setMines();
-	setHints();
+	initializeVect(solutionBoard, '0', '0');
+	initializeVect(mineBytes, 0, 0);
+	initializeBits();
+	setNeighborCellOffsets();
+	mineCells.clear();
+	changedCells.clear();
+	revealedCells.clear();
+	revealLog.clear();
+	revealQueue.reserve(rows * cols);
+	revealedCells.reserve(rows * cols);
+	revealLog.reserve(rows * cols);
+	minesPlaced = false;
+	if (!safeOpening) {
+		setMines(-1);
+		setHints();
+	}
 }
 
 /**
 * 
-* MinesweeperBoard::~MinesweeperBoard() 
+* bool MinesweeperBoard::restore(const MinesweeperSnapshot &snapshot) 
 * 
-* Summary: Destructor
+* Summary: Continues a game saved with MinesweeperSnapshot::save
 * 
+* Parameters:	MinesweeperSnapshot of an open file
+* 				
+* Returns:	    bool - false if the file is damaged, in which case the board
+*				is unchanged
+*
+* Description: The saved bitboards are copied straight into the board, and 
+*	the hints, mine list and reveal order are rebuilt from them. The 
+*	generator continues where it was saved, so random reveals and a safe 
+*	opening's mines come out the same as they would have. Any 
+*	MinesweeperSolver playing this board must be reset.
+*
+*	The reveal order is not saved, so it is rebuilt in board order. A solver
+*	may break ties between equally good guesses differently than it would 
+*	have in the original game.
+*
+*	The checksum only finds accidental damage, so the bitboards are also
+*	checked with validSnapshot before anything is copied.
+*
 **/
-MinesweeperBoard::~MinesweeperBoard() 
+bool MinesweeperBoard::restore(const MinesweeperSnapshot &snapshot) 
+{
+	if (!snapshot.verify() || !validSnapshot(snapshot)) {
+		return false;
+	}
+
+	this->rows = snapshot.getRows();
+	this->cols = snapshot.getCols();
+	this->mines = snapshot.getMines();
+	this->stride = cols + 2;
+	this->flagEdits = 0;
+	this->seed = snapshot.getSeed();
+	this->safeOpening = snapshot.getSafeOpening();
+	this->minesPlaced = snapshot.getMinesPlaced();
+	random.setState(snapshot.getRandomState());
+
+	initializeVect(solutionBoard, '0', '0');
+	initializeVect(mineBytes, 0, 0);
+	initializeBits();
+	setNeighborCellOffsets();
+	mineBits.setWords(snapshot.getMineWords());
+	revealedBits.setWords(snapshot.getRevealedWords());
+	flaggedBits.setWords(snapshot.getFlaggedWords());
+
+	mineCells.clear();
+	mineCells.reserve(mines);
+	for (int idx = mineBits.nextSet(0); idx >= 0; 
+			idx = mineBits.nextSet(idx + 1)) {
+		mineBytes[idx] = 1;
+		mineCells.push_back(idx);
+	}
+	if (minesPlaced) {
+		setHints();
+	}
+
+	changedCells.clear();
+	revealedCells.clear();
+	revealLog.clear();
+	revealQueue.reserve(rows * cols);
+	revealedCells.reserve(rows * cols);
+	revealLog.reserve(rows * cols);
+	for (int idx = revealedBits.nextSet(0); idx >= 0; 
+			idx = revealedBits.nextSet(idx + 1)) {
+		int col = idx % stride;
+		if (idx >= stride && idx < (rows + 1) * stride 
+				&& col != 0 && col != stride - 1) {
+			revealLog.push_back(idx);	// skip the border
+		}
+	}
+
+	this->revealedCount = revealLog.size();
+	this->mineHit = revealedBits.intersects(mineBits);
+	this->flagsRemaining = mines - flaggedBits.count();
+	return true;
+}
+
+/**
+* 
+* static bool MinesweeperBoard::validSnapshot(
+*		const MinesweeperSnapshot &snapshot) 
+* 
+* Summary: Checks that a snapshot's bitboards describe a board that can be 
+*	played
+* 
+* Parameters:	MinesweeperSnapshot of an open file
+* 				
+* Returns:	    bool - false if the bitboards can't come from a real game
+*
+* Description: The flood fill and the hints rely on the border being 
+*	revealed, with no mines or flags on it, so a file that breaks that 
+*	would send them off the end of the board. Bits past the last cell must
+*	be clear, and the mine count must match the header once mines have
+*	been placed (and be 0 before).
+*
+**/
+bool MinesweeperBoard::validSnapshot(const MinesweeperSnapshot &snapshot) 
 {
+	int rows = snapshot.getRows();
+	int cols = snapshot.getCols();
+	int stride = cols + 2;
+	int boardSize = (rows + 2) * stride;
+
+	const uint64_t *sources[] = {snapshot.getMineWords(), 
+			snapshot.getRevealedWords(), snapshot.getFlaggedWords()};
+	if (boardSize % 64 != 0) {
+		uint64_t pastEnd = ~(uint64_t)0 << (boardSize % 64);
+		for (int b = 0; b < 3; b++) {
+			if (sources[b][snapshot.getWordCount() - 1] & pastEnd) {
+				return false;
+			}
+		}
+	}
+
+	MinesweeperBitboard mineBits, revealedBits, flaggedBits;
+	mineBits.resize(boardSize);
+	revealedBits.resize(boardSize);
+	flaggedBits.resize(boardSize);
+	mineBits.setWords(sources[0]);
+	revealedBits.setWords(sources[1]);
+	flaggedBits.setWords(sources[2]);
+
+	int expectedMines = snapshot.getMinesPlaced() ? snapshot.getMines() : 0;
+	if (mineBits.count() != expectedMines) {
+		return false;
+	}
+
+	vector<int> border;
+	border.reserve(2 * stride + 2 * rows);
+	for (int j = 0; j < stride; j++) {
+		border.push_back(j);
+		border.push_back((rows + 1) * stride + j);
+	}
+	for (int i = 1; i <= rows; i++) {
+		border.push_back(i * stride);
+		border.push_back(i * stride + stride - 1);
+	}
+	for (size_t i = 0; i < border.size(); i++) {
+		int idx = border[i];
+		if (!revealedBits.test(idx) || mineBits.test(idx) 
+				|| flaggedBits.test(idx)) {
+			return false;
+		}
+	}
+	return true;
+}
 
+/**
+* 
+* void MinesweeperBoard::setSafeOpening(bool safeOpening) 
+* 
+* Summary: Sets whether the first reveal is always an opening
+* 
+* Parameters:	bool - true to keep mines off the first cell revealed and its
+*				neighbors
+* 				
+* Returns:	    void
+*
+* Description: Takes effect from the next reset.
+*
+**/
+void MinesweeperBoard::setSafeOpening(bool safeOpening) 
+{
+	this->safeOpening = safeOpening;
 }
 
 /**
 * 
-* void MinesweeperBoard::initializeVect(vector<vector<char>> &vect, 
-*		int rows, int cols, char fillerChar) 
+* void MinesweeperBoard::initializeVect(vector<char> &vect, char fillerChar,
+*		char borderChar) 
 * 
-* Summary: Initializes a 2D vector to a specified filler char
+* Summary: Initializes a padded board to a specified filler char
 * 
-* Parameters:	vector of vector of char (reference)
-*				int for the number of rows to initialize
-*				int for the number of cols to initialize
-*				char for the character to fill the vector
+* Parameters:	vector of char (reference)
+*				char for the character to fill the playable cells
+*				char for the character to fill the border cells
 * 				
 * Returns:	    void
+*
+* Description: Boards are stored as a single row-major buffer with a one 
+*	cell border on every side, so that every playable cell has 8 neighbors in 
+*	memory and neighbor lookups never leave the buffer.
+*
+*	# # # # # #
+*	# - - - - #
+*	# - - - - #
+*	# - - - - #
+*	# # # # # #
 * 
 **/
-void MinesweeperBoard::initializeVect(vector<vector<char>> &vect, 
-		int rows, int cols, char fillerChar) 
+void MinesweeperBoard::initializeVect(vector<char> &vect, char fillerChar,
+		char borderChar) 
 {
+	vect.assign((rows + 2) * stride, borderChar);
+	if (fillerChar == borderChar) {
+		return;
+	}
 	for (int i = 0; i < rows; i++) {
-		vect.push_back({});
+		int idx = cellIndex(i, 0);
 		for (int j = 0; j < cols; j++) {
-			vect[i].push_back(fillerChar);
+			vect[idx + j] = fillerChar;
 		}
 	}
 }
 
 /**
 * 
-* void MinesweeperBoard::setNeighborCellCoordinates() 
+* void MinesweeperBoard::initializeBits() 
+* 
+* Summary: Initializes the player bitboards
+* 
+* Parameters:	none (uses member variables)
+* 				
+* Returns:	    void
+*
+* Description: The bitboards use the same padded layout as the solution board.
+*	Border cells are marked as revealed so that the game logic treats them as
+*	already uncovered, which means they are never flagged or revealed. The
+*	number of border cells is stored so it can be left out of revealed counts.
+* 
+**/
+void MinesweeperBoard::initializeBits()
+{
+	int boardSize = (rows + 2) * stride;
+
+	mineBits.resize(boardSize);
+	revealedBits.resize(boardSize);
+	flaggedBits.resize(boardSize);
+	changedBits.resize(boardSize);
+
+	// only the border is set, so this is cheap even for very large boards
+	for (int j = 0; j < stride; j++) {
+		revealedBits.set(j);
+		revealedBits.set((rows + 1) * stride + j);
+	}
+	for (int i = 0; i < rows; i++) {
+		revealedBits.set(cellIndex(i, -1));
+		revealedBits.set(cellIndex(i, cols));
+	}
+	borderCells = boardSize - rows * cols;
+}
+
+/**
+* 
+* void MinesweeperBoard::setNeighborCellOffsets() 
 * 
-* Summary: Initializes a 2D vector to a specified filler char
+* Summary: Initializes the neighbor offsets for the padded boards
 * 
 * Parameters:	none (uses member variables)
 * 				
 * Returns:	    void
 *
-* Description: Creates a vector of int pairs to use when iterating through all
-*	neighbors of a cell. The vector stores the locations surrounding cell:
+* Description: Stores the distance in the padded buffer from a cell to each of
+*	its neighbors. Used when iterating through all neighbors of a cell:
 *
-*	[-1,-1]  [-1,0]  [-1,1]
-*	[0, -1]  [cell]  [0, 1]
-*	[1, -1]  [1, 0]  [1, 1]
+*	[-stride-1]  [-stride]  [-stride+1]
+*	[-1]         [cell]     [1]
+*	[stride-1]   [stride]   [stride+1]
 * 
 **/
-void MinesweeperBoard::setNeighborCellCoordinates()
+void MinesweeperBoard::setNeighborCellOffsets()
 {
-	neighborCellCoordinates.push_back(pair<int, int>(-1, -1));	// up left
-	neighborCellCoordinates.push_back(pair<int, int>(-1, 0));	// up
-	neighborCellCoordinates.push_back(pair<int, int>(-1, 1));	// up right
-	neighborCellCoordinates.push_back(pair<int, int>(0, -1));	// left
-	neighborCellCoordinates.push_back(pair<int, int>(0, 1));	// right
-	neighborCellCoordinates.push_back(pair<int, int>(1, -1));	// down left
-	neighborCellCoordinates.push_back(pair<int, int>(1, 0));	// down
-	neighborCellCoordinates.push_back(pair<int, int>(1, 1));	// down right
+	neighborCellOffsets[0] = -stride - 1;	// up left
+	neighborCellOffsets[1] = -stride;		// up
+	neighborCellOffsets[2] = -stride + 1;	// up right
+	neighborCellOffsets[3] = -1;			// left
+	neighborCellOffsets[4] = 1;				// right
+	neighborCellOffsets[5] = stride - 1;	// down left
+	neighborCellOffsets[6] = stride;		// down
+	neighborCellOffsets[7] = stride + 1;	// down right
 }
 
 /**
 * 
-* void MinesweeperBoard::setMines()
+* void MinesweeperBoard::setMines(int safeIdx)
 * 
 * Summary: Sets mines on the board
 * 
-* Parameters:	none (uses member variables)
+* Parameters:	int for the padded board index of a cell to keep clear, or -1
 * 				
 * Returns:	    void
 *
-* Description: Generates random coordinates using randomNumber helper function 
-*	and changes cell from '0' to '*'. Mine locations are also stored in 
-*	mineCoordinates vector.
+* Description: Chooses exactly mines cells without retrying, so placement 
+*	takes the same time however dense the board is. Sparse boards draw mines 
+*	with Floyd's sampling algorithm, one random number per mine. Dense boards
+*	shuffle a list of candidate cells instead, since the list costs about as 
+*	much as the mines themselves. Chosen cells are marked in the mine plane
+*	and bitboard, and setHints turns them into '*'. Mine locations are also 
+*	stored in mineCells vector.
+*
+*	When safeIdx is a cell, it and its neighbors are left out so the first 
+*	reveal opens an area (see setExclusionZone).
 *
 *	0 0 0 0 0 0 0 0 0 0 				0 0 0 0 0 0 0 0 0 0 
 *	0 0 0 0 0 0 0 0 0 0 				* 0 * * 0 0 0 0 0 0 
@@ -134,22 +419,182 @@ void MinesweeperBoard::setNeighborCellCoordinates()
 *	0 0 0 0 0 0 0 0 0 0 				0 0 0 0 0 0 0 0 0 0 
 * 
 **/
-void MinesweeperBoard::setMines()
+void MinesweeperBoard::setMines(int safeIdx)
 {
-	for (int i = 0; i < mines; i++) {
-		bool openSpot = false;
+	int zone[NEIGHBOR_COUNT + 1];
+	int zoneCount = setExclusionZone(safeIdx, zone);
+	int candidates = rows * cols - zoneCount;
 
-		while (!openSpot) {
-			int row = randomNumber(0, rows - 1);
-			int col = randomNumber(0, cols - 1);
+	mineCells.clear();
+	mineCells.reserve(mines);
 
-			if (solutionBoard[row][col] == '0') { 
-				openSpot = true;
-				solutionBoard[row][col] = '*';
-				mineCoordinates.push_back(pair<int, int>(row, col));
+	if (mines * 2 > candidates) {
+		shuffleMines(candidates, zone, zoneCount);
+	}
+	else {
+		sampleMines(candidates, zone, zoneCount);
+	}
+	minesPlaced = true;
+}
+
+/**
+* 
+* int MinesweeperBoard::setExclusionZone(int safeIdx, int *zone)
+* 
+* Summary: Lists the cells that must not get a mine
+* 
+* Parameters:	int for the padded board index of the safe cell, or -1
+*				int array (at least 9) to fill with the excluded cells
+* 				
+* Returns:	    int for the number of excluded cells
+*
+* Description: Cells are stored as row * cols + col in ascending order. The
+*	zone is the safe cell and its neighbors. If there would not be enough 
+*	cells left for every mine, only the safe cell is excluded, and if even 
+*	that is too many nothing is excluded.
+*
+**/
+int MinesweeperBoard::setExclusionZone(int safeIdx, int *zone)
+{
+	if (safeIdx < 0 || mines >= rows * cols) {
+		return 0;
+	}
+
+	int safeRow = safeIdx / stride - 1;
+	int safeCol = safeIdx % stride - 1;
+	int count = 0;
+
+	for (int i = safeRow - 1; i <= safeRow + 1; i++) {
+		for (int j = safeCol - 1; j <= safeCol + 1; j++) {
+			if (isInBounds(i, j)) {
+				zone[count++] = i * cols + j;
 			}
 		}
 	}
+
+	if (mines > rows * cols - count) {
+		zone[0] = safeRow * cols + safeCol;
+		count = 1;
+	}
+	return count;
+}
+
+/**
+* 
+* int MinesweeperBoard::candidateIndex(int ordinal, const int *zone, 
+*		int zoneCount)
+* 
+* Summary: Finds the padded board index of the nth cell outside the zone
+* 
+* Parameters:	int for the position among cells that may hold a mine
+*				int array of excluded cells in ascending order
+*				int for the number of excluded cells
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperBoard::candidateIndex(int ordinal, const int *zone, 
+		int zoneCount)
+{
+	for (int i = 0; i < zoneCount; i++) {
+		if (zone[i] <= ordinal) {
+			ordinal++;
+		}
+	}
+	return cellIndex(ordinal / cols, ordinal % cols);
+}
+
+/**
+* 
+* void MinesweeperBoard::placeMine(int idx)
+* 
+* Summary: Puts a mine on a cell
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperBoard::placeMine(int idx)
+{
+	mineBytes[idx] = 1;
+	mineBits.set(idx);
+	mineCells.push_back(idx);
+}
+
+/**
+* 
+* void MinesweeperBoard::shuffleMines(int candidates, const int *zone, 
+*		int zoneCount)
+* 
+* Summary: Places mines with a partial Fisher-Yates shuffle
+* 
+* Parameters:	int for the number of cells that may hold a mine
+*				int array of excluded cells in ascending order
+*				int for the number of excluded cells
+* 				
+* Returns:	    void
+*
+* Description: Lists every candidate cell, then moves a random remaining cell
+*	to the front once per mine. The flood fill queue is not in use while 
+*	mines are placed, so it holds the list.
+*
+**/
+void MinesweeperBoard::shuffleMines(int candidates, const int *zone, 
+		int zoneCount)
+{
+	vector<int> &cells = revealQueue;
+	cells.clear();
+
+	int next = 0;
+	for (int i = 0; i < rows; i++) {
+		int idx = cellIndex(i, 0);
+		for (int j = 0; j < cols; j++, idx++) {
+			if (next < zoneCount && zone[next] == i * cols + j) {
+				next++;
+				continue;
+			}
+			cells.push_back(idx);
+		}
+	}
+
+	for (int i = 0; i < mines; i++) {
+		int choice = random.range(i, candidates - 1);
+		std::swap(cells[i], cells[choice]);
+		placeMine(cells[i]);
+	}
+}
+
+/**
+* 
+* void MinesweeperBoard::sampleMines(int candidates, const int *zone, 
+*		int zoneCount)
+* 
+* Summary: Places mines with Floyd's sampling algorithm
+* 
+* Parameters:	int for the number of cells that may hold a mine
+*				int array of excluded cells in ascending order
+*				int for the number of excluded cells
+* 				
+* Returns:	    void
+*
+* Description: For each of the last mines candidates, picks a random cell at
+*	or before it. If that cell already has a mine, the candidate itself is 
+*	used, which it can't have yet. The mine bitboard answers "already has a 
+*	mine", so every mine costs one random number and no retries.
+*
+**/
+void MinesweeperBoard::sampleMines(int candidates, const int *zone, 
+		int zoneCount)
+{
+	for (int last = candidates - mines; last < candidates; last++) {
+		int idx = candidateIndex(random.range(0, last), zone, zoneCount);
+
+		if (mineBits.test(idx)) {
+			idx = candidateIndex(last, zone, zoneCount);
+		}
+		placeMine(idx);
+	}
 }
 
 /**
@@ -162,8 +607,14 @@ void MinesweeperBoard::setMines()
 * 				
 * Returns:	    void
 *
-* Description: Iterates through all mine locations and increments neighboring
-*	cells by 1. Each cell will store the total number of neighboring mines.
+* Description: Each cell will store the total number of neighboring mines, 
+*	which is the sum of the mine plane over the 3x3 box around it. The sums 
+*	are computed a row at a time with SIMD instructions when the processor 
+*	has them (see minesweeperHints.cpp), so the cost depends on the board size
+*	and not on how many mines it has.
+*
+*	Debug builds (-DMINESWEEPER_DEBUG) also check every hint against a count 
+*	of the mines around each mine.
 *
 *	0 0 0 0 0 0 0 0 0 0 				1 2 2 2 1 0 0 0 0 0 
 *	* 0 * * 0 0 0 0 0 0 				* 2 * * 1 0 0 0 0 0 
@@ -180,24 +631,61 @@ void MinesweeperBoard::setMines()
 **/
 void MinesweeperBoard::setHints() 
 {
-	for (size_t i = 0; i < mineCoordinates.size(); i++) {
-		// iterate through all mine coordinates
-		int row = mineCoordinates[i].first;
-		int col = mineCoordinates[i].second;
+	countNeighborMines(mineBytes.data(), solutionBoard.data(), rows, cols, 
+			stride);
+
+#ifdef MINESWEEPER_DEBUG
+	assert(scanHints());
+#endif
+}
 
-		for (size_t j = 0; j < neighborCellCoordinates.size(); j++) {
+/**
+* 
+* bool MinesweeperBoard::scanHints() 
+* 
+* Summary: Checks the hints against the mine locations
+* 
+* Parameters:	none (uses member variables)
+* 				
+* Returns:	    bool - true if every hint is correct
+*
+* Description: Recounts the hints the simple way, by adding 1 to the 
+*	neighbors of every mine, and compares them to the solution board. Only 
+*	used by debug builds.
+*
+**/
+bool MinesweeperBoard::scanHints() 
+{
+	vector<char> expected;
+	initializeVect(expected, '0', '0');
+
+	for (size_t i = 0; i < mineCells.size(); i++) {
+		int idx = mineCells[i];
+		expected[idx] = '*';
+	}
+	for (size_t i = 0; i < mineCells.size(); i++) {
+		// iterate through all mine locations
+		int idx = mineCells[i];
+
+		for (int k = 0; k < NEIGHBOR_COUNT; k++) {
 			// iterate through all neighboring cells
-			int rowOffset = neighborCellCoordinates[j].first;
-			int colOffset = neighborCellCoordinates[j].second;
-			int neighborRow = row + rowOffset;
-			int neighborCol = col + colOffset;
-
-			if (isInBounds(neighborRow, neighborCol) 
-					&& solutionBoard[neighborRow][neighborCol] != '*') {
-				solutionBoard[neighborRow][neighborCol] += 1;
+			int neighbor = idx + neighborCellOffsets[k];
+
+			if (expected[neighbor] != '*') {
+				expected[neighbor] += 1;
 			}
 		}
 	}
+
+	for (int i = 0; i < rows; i++) {
+		int idx = cellIndex(i, 0);
+		for (int j = 0; j < cols; j++, idx++) {
+			if (expected[idx] != solutionBoard[idx]) {
+				return false;
+			}
+		}
+	}
+	return true;
 }
 
 /**
@@ -228,30 +716,69 @@ bool MinesweeperBoard::isInBounds(int row, int col)
 * 
 * Parameters:	none
 * 				
-* Returns:	    void
+* Returns:	    Status
 *
-* Description: Counts the number of cells that have been revealed on the board
-*	to determine when the game has been won. If the number of mines is the same 
-*	as the number of cells that are covered, the game is won. If there is a mine
-*	showing on the board, the game is lost.
+* Description: Uses the counters kept up to date by the reveal functions, so 
+*	this runs in constant time. If the number of mines is the same as the 
+*	number of cells that are covered, the game is won. If a mine has been 
+*	revealed, the game is lost.
+*
+*	Debug builds (-DMINESWEEPER_DEBUG) also check the result against a scan of
+*	the full board.
 *
 **/
 Status MinesweeperBoard::checkGameState()
+{
+	Status state = PENDING;
+
+	if (mineHit) {
+		state = LOSE;
+	}
+	else if (revealedCount == (rows * cols - mines)) { 
+		// game is won if there are exactly # of mines spaces left covered
+		state = WIN;
+	}
+	STATS_ADD(GAME_STATE_CHECKS, 1);
+
+#ifdef MINESWEEPER_DEBUG
+	assert(state == scanGameState());
+#endif
+	return state;
+}
+
+/**
+* 
+* Status MinesweeperBoard::scanGameState()
+* 
+* Summary: Checks the game state by scanning the whole board
+* 
+* Parameters:	none
+* 				
+* Returns:	    Status
+*
+* Description: Counts the number of cells that have been revealed on the board
+*	to determine when the game has been won. If there is a mine showing on the
+*	board, the game is lost. Only used to verify the counters.
+*
+**/
+Status MinesweeperBoard::scanGameState()
 {
 	int countRevealed = 0;
 
 	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < cols; j++) {
-			if (playerBoard[i][j] == '*') {
+		int idx = cellIndex(i, 0);
+		for (int j = 0; j < cols; j++, idx++) {
+			char cell = playerCell(idx);
+
+			if (cell == '*') {
 				return LOSE;
 			}
-			if (playerBoard[i][j] != '-' && playerBoard[i][j] != '?') {
+			if (cell != '-' && cell != '?') {
 				countRevealed++;
 			}
 		}
 	}
 
-	// game is won if there are exactly # of mines spaces left covered
 	if (countRevealed == (rows * cols - mines)) { 
 		return WIN;
 	}
@@ -277,25 +804,47 @@ bool MinesweeperBoard::verifyFlags()
 		return false;
 	}
 
+	switch (stride) {
+		case BEGINNER_STRIDE:
+			return checkFlagCounts<BEGINNER_STRIDE>();
+		case INTERMEDIATE_STRIDE:
+			return checkFlagCounts<INTERMEDIATE_STRIDE>();
+		case EXPERT_STRIDE:
+			return checkFlagCounts<EXPERT_STRIDE>();
+		default:
+			return checkFlagCounts<0>();
+	}
+}
+
+/**
+* 
+* template <int STRIDE> bool MinesweeperBoard::checkFlagCounts()
+* 
+* Summary: Checks that no numbered cell has more flags around it than its hint
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+* 				
+* Returns:	    bool - true if no hint is exceeded
+*
+* Description: Compiled once per preset board width by verifyFlags (see 
+*	minesweeperNeighbors.hpp).
+*
+**/
+template <int STRIDE>
+bool MinesweeperBoard::checkFlagCounts()
+{
 	// count neighboring flags for numbered cells
 	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < cols; j++) {
-			if (playerBoard[i][j] > '0' && playerBoard[i][j] < '9') {
+		int idx = cellIndex(i, 0);
+		for (int j = 0; j < cols; j++, idx++) {
+			if (revealedBits.test(idx) 
+					&& solutionBoard[idx] > '0' && solutionBoard[idx] < '9') {
 				int surroundingFlags = 0;
 				// check all neighbors
-				for (size_t k = 0; k < neighborCellCoordinates.size(); k++) {
-					// iterate through all neighboring cells
-					int rowOffset = neighborCellCoordinates[k].first;
-					int colOffset = neighborCellCoordinates[k].second;
-					int neighborRow = i + rowOffset;
-					int neighborCol = j + colOffset;
-
-					if (isInBounds(neighborRow, neighborCol) 
-							&& playerBoard[neighborRow][neighborCol] == '?') {
-						surroundingFlags += 1;
-					}
-				}
-				if (surroundingFlags > playerBoard[i][j] - 48) {
+				forEachNeighbor<STRIDE>(idx, stride, [&](int neighbor) {
+					surroundingFlags += flaggedBits.test(neighbor);
+				});
+				if (surroundingFlags > solutionBoard[idx] - 48) {
 					// convert numeric char on board to int for comparison
 					return false;
 				}
@@ -307,86 +856,259 @@ bool MinesweeperBoard::verifyFlags()
 
 /**
 * 
-* void MinesweeperBoard::revealCell(int row, int col) 
+* const vector<pair<int, int>> &MinesweeperBoard::revealCell(int row, int col) 
 * 
 * Summary: Reveals cell on board and all neighboring cells 
 * 
 * Parameters:	int for the row of the cell to uncover
 *				int for the col of the cell to uncover
 * 				
+* Returns:	    vector of int pairs - coordinates of every cell uncovered by
+*				this move. Only valid until the next reveal.
+*
+**/
+const vector<pair<int, int>> &MinesweeperBoard::revealCell(int row, int col) 
+{
+	// timed here, not in revealIndex, so the solver's one cell reveals
+	// don't pay for two clock reads each
+	STATS_TIMER(REVEAL_TIMER);
+	TRACE_SPAN("board", "reveal");
+
+	revealIndex(cellIndex(row, col));
+	return getRevealedCoordinates();
+}
+
+/**
+* 
+* void MinesweeperBoard::revealIndex(int idx) 
+* 
+* Summary: Reveals cell on board and all neighboring cells 
+* 
+* Parameters:	int for the padded board index of the cell to uncover
+* 				
 * Returns:	    void
 *
-* Description: Uses modified DFS to recursively uncover neighboring cells
+* Description: Uses a breadth first flood fill to uncover neighboring cells.
+*	Every cell is marked as revealed before it is queued, so it is queued at
+*	most once and the preallocated queue never grows. The border is marked as
+*	revealed so the search never leaves the board. Uncovered cells are stored
+*	in revealedCells in the order they were revealed.
+*
+*	Places the mines first if the board is waiting for a safe opening.
 *
 **/
-void MinesweeperBoard::revealCell(int row, int col) 
+void MinesweeperBoard::revealIndex(int idx) 
 {
-	if (solutionBoard[row][col] == '*') {
+	if (!minesPlaced) {
+		// safe opening, the board is filled around the first reveal
+		setMines(idx);
+		setHints();
+	}
+	revealedCells.clear();
+
+	if (solutionBoard[idx] == '*') {
 		// hit a mine
-		playerBoard[row][col] = '*';
+		openIndex(idx);
+		mineHit = true;
 		return;
 	}
-	else if (solutionBoard[row][col] == '0' && playerBoard[row][col]) {
-		if (playerBoard[row][col] == '?') {
-			flagsRemaining += 1;
+	else if (solutionBoard[idx] != '0') {
+		if (!revealedBits.test(idx) && !flaggedBits.test(idx)) {
+			openIndex(idx);
 		}
-		// mark cell as visited
-		playerBoard[row][col] = ' ';
+		return;
+	}
 
-		// recursively check all neighbors
-		for (size_t j = 0; j < neighborCellCoordinates.size(); j++) {
-			// iterate through all neighboring cells
-			int rowOffset = neighborCellCoordinates[j].first;
-			int colOffset = neighborCellCoordinates[j].second;
-			int neighborRow = row + rowOffset;
-			int neighborCol = col + colOffset;
-
-			if (isInBounds(neighborRow, neighborCol) 
-					&& playerBoard[neighborRow][neighborCol] != ' ') {
-				revealCell(neighborRow, neighborCol);
-			}
+	openIndex(idx);
+	revealQueue.clear();
+	revealQueue.push_back(idx);
+
+	switch (stride) {
+		case BEGINNER_STRIDE:
+			floodFill<BEGINNER_STRIDE>();
+			break;
+		case INTERMEDIATE_STRIDE:
+			floodFill<INTERMEDIATE_STRIDE>();
+			break;
+		case EXPERT_STRIDE:
+			floodFill<EXPERT_STRIDE>();
+			break;
+		default:
+			floodFill<0>();
+			break;
+	}
+}
+
+/**
+* 
+* template <int STRIDE> void MinesweeperBoard::floodFill() 
+* 
+* Summary: Uncovers the area around the blank cells in the reveal queue
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+* 				
+* Returns:	    void
+*
+* Description: The breadth first search for revealIndex. Compiled once per 
+*	preset board width (see minesweeperNeighbors.hpp). Stats builds count 
+*	the levels of the search as its depth.
+*
+**/
+template <int STRIDE>
+void MinesweeperBoard::floodFill()
+{
+#ifdef MINESWEEPER_STATS
+	size_t levelEnd = 0;	// queue position where the next level starts
+	uint64_t depth = 0;
+#endif
+
+	for (size_t head = 0; head < revealQueue.size(); head++) {
+		int current = revealQueue[head];
+#ifdef MINESWEEPER_STATS
+		if (head == levelEnd) {
+			levelEnd = revealQueue.size();
+			depth += 1;
 		}
+#endif
+
+		// iterate through all neighboring cells
+		forEachNeighbor<STRIDE>(current, stride, [&](int neighbor) {
+			if (revealedBits.test(neighbor)) {
+				return;
+			}
+			if (solutionBoard[neighbor] == '0') {
+				// blanks are uncovered even if flagged and keep spreading
+				openIndex(neighbor);
+				revealQueue.push_back(neighbor);
+			}
+			else if (!flaggedBits.test(neighbor)) {
+				openIndex(neighbor);
+			}
+		});
+	}
+	STATS_ADD(FLOOD_FILLS, 1);
+	STATS_ADD(FLOOD_DEPTH, depth);
+	STATS_MAX(FLOOD_DEPTH_MAX, depth);
+}
+
+/**
+* 
+* void MinesweeperBoard::openIndex(int idx) 
+* 
+* Summary: Uncovers a single cell and updates the counters
+* 
+* Parameters:	int for the padded board index of the cell to uncover
+* 				
+* Returns:	    void
+*
+* Description: Removes a flag from the cell if there is one. Does nothing if
+*	the cell is already uncovered. Uncovered cells are also added to the 
+*	revealLog, which MinesweeperSolver reads to keep its frontier up to date.
+*
+**/
+void MinesweeperBoard::openIndex(int idx) 
+{
+	if (flaggedBits.test(idx)) {
+		flaggedBits.reset(idx);
+		flagsRemaining += 1;
+		flagEdits += 1;
+		markChanged(idx);
 	}
-	else if (playerBoard[row][col] == '-') {
-		playerBoard[row][col] = solutionBoard[row][col];
+	if (!revealedBits.test(idx)) {
+		revealedBits.set(idx);
+		revealedCount += 1;
+		markChanged(idx);
+		revealedCells.push_back(idx);
+		revealLog.push_back(idx);
+		STATS_ADD(CELLS_OPENED, 1);
 	}
 }
 
 /**
 * 
-* void MinesweeperBoard::revealRandomCell() 
+* const vector<pair<int, int>> &MinesweeperBoard::getRevealedCoordinates() 
 * 
-* Summary: Reveals a random cell on the board
+* Summary: Returns the cells uncovered by the last reveal
 * 
 * Parameters:	none
 * 				
+* Returns:	    vector of int pairs - row and col of each uncovered cell
+*
+**/
+const vector<pair<int, int>> &MinesweeperBoard::getRevealedCoordinates() 
+{
+	revealedCoordinates.clear();
+	for (size_t i = 0; i < revealedCells.size(); i++) {
+		revealedCoordinates.push_back(pair<int, int>(
+				revealedCells[i] / stride - 1, revealedCells[i] % stride - 1));
+	}
+	return revealedCoordinates;
+}
+
+/**
+* 
+* void MinesweeperBoard::markChanged(int idx) 
+* 
+* Summary: Records that the display char of a cell has changed
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
 * Returns:	    void
 *
+**/
+void MinesweeperBoard::markChanged(int idx) 
+{
+	if (!changedBits.test(idx)) {
+		changedBits.set(idx);
+		changedCells.push_back(idx);
+	}
+}
+
+/**
+* 
+* const vector<pair<int, int>> &MinesweeperBoard::revealRandomCell() 
+* 
+* Summary: Reveals a random cell on the board
+* 
+* Parameters:	none
+* 				
+* Returns:	    vector of int pairs - coordinates of every cell uncovered
+*
 * Description: Rather than choosing any random cell, which could take an
 *	indeterminate amount of time to find a valid move, this function creates
 *	a vector of all possible moves and makes a random choice from the moves
 *	that are available. This will always take O(n) time worst case.
 *
+*	Returns the cells uncovered, the same as revealCell.
+*
 **/
-void MinesweeperBoard::revealRandomCell() 
+const vector<pair<int, int>> &MinesweeperBoard::revealRandomCell() 
 {
-	vector<pair<int, int>> possibleMoveCoordinates;
+	TRACE_SPAN("board", "reveal random");
+
+	// the flood fill queue is free until the reveal, so collect moves in it
+	vector<int> &possibleMoves = revealQueue;
+	possibleMoves.clear();
 
 	// add all covered cells as potential moves
 	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < cols; j++) {
-			if (playerBoard[i][j] == '-') {
-				possibleMoveCoordinates.push_back(pair<int, int>(i, j));
+		int idx = cellIndex(i, 0);
+		for (int j = 0; j < cols; j++, idx++) {
+			if (!revealedBits.test(idx) && !flaggedBits.test(idx)) {
+				possibleMoves.push_back(idx);
 			}
 		}
 	}
 
 	// choose randomly if there is a move to make
-	if (!possibleMoveCoordinates.empty()) {
-		int randomChoice = randomNumber(0, possibleMoveCoordinates.size() - 1);
-		revealCell(possibleMoveCoordinates[randomChoice].first, 
-					possibleMoveCoordinates[randomChoice].second);
+	if (!possibleMoves.empty()) {
+		int randomChoice = random.range(0, possibleMoves.size() - 1);
+		revealIndex(possibleMoves[randomChoice]);
+	}
+	else {
+		revealedCells.clear();
 	}
+	return getRevealedCoordinates();
 }
 
 /**
@@ -399,18 +1121,21 @@ void MinesweeperBoard::revealRandomCell()
 * 				
 * Returns:	    void
 *
-* Description: Uncovers all mines while leaving flags
+* Description: Uncovers all mines while leaving flags. Only called once the
+*	game is over, so the counters are simply recounted.
 *
 **/
 void MinesweeperBoard::revealMines() 
 {
-	for (size_t i = 0; i < mineCoordinates.size(); i++) {
-		if (playerBoard[mineCoordinates[i].first]
-						[mineCoordinates[i].second] != '?') {
-			playerBoard[mineCoordinates[i].first]
-						[mineCoordinates[i].second] = '*';
+	for (size_t i = 0; i < mineCells.size(); i++) {
+		if (!revealedBits.test(mineCells[i]) 
+				&& !flaggedBits.test(mineCells[i])) {
+			markChanged(mineCells[i]);
 		}
 	}
+	revealedBits.setMasked(mineBits, flaggedBits);
+	revealedCount = revealedBits.count() - borderCells;
+	mineHit = mineBits.intersects(revealedBits);
 }
 
 /**
@@ -427,9 +1152,27 @@ void MinesweeperBoard::revealMines()
 **/
 bool MinesweeperBoard::flagCell(int row, int col) 
 {
-	if (playerBoard[row][col] == '-') {
+	return flagIndex(cellIndex(row, col));
+}
+
+/**
+* 
+* bool MinesweeperBoard::flagIndex(int idx) 
+* 
+* Summary: Flags a cell and updates flagsRemaining count
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    bool - true if the cell was changed to flag
+*
+**/
+bool MinesweeperBoard::flagIndex(int idx) 
+{
+	if (!revealedBits.test(idx) && !flaggedBits.test(idx)) {
 		flagsRemaining -= 1;
-		playerBoard[row][col] = '?';
+		flagEdits += 1;
+		flaggedBits.set(idx);
+		markChanged(idx);
 		return true;
 	}
 	return false;
@@ -449,9 +1192,13 @@ bool MinesweeperBoard::flagCell(int row, int col)
 **/
 bool MinesweeperBoard::unflagCell(int row, int col)
 {
-	if (playerBoard[row][col] == '?') {
+	int idx = cellIndex(row, col);
+
+	if (flaggedBits.test(idx)) {
 		flagsRemaining += 1;
-		playerBoard[row][col] = '-';
+		flagEdits += 1;
+		flaggedBits.reset(idx);
+		markChanged(idx);
 		return true;
 	}
 	return false;
@@ -471,12 +1218,11 @@ bool MinesweeperBoard::unflagCell(int row, int col)
 **/
 void MinesweeperBoard::flipCellFlag(int row, int col)
 {
-	if (playerBoard[row][col] == '-') {
+	TRACE_SPAN("board", "flag");
+
+	if (!unflagCell(row, col)) {
 		flagCell(row, col);
 	}
-	else if (playerBoard[row][col] == '?') {
-		unflagCell(row, col);
-	}
 }
 
 /**
@@ -493,13 +1239,44 @@ void MinesweeperBoard::flipCellFlag(int row, int col)
 **/
 void MinesweeperBoard::clearFlags()
 {
-	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < cols; j++) {
-			if (playerBoard[i][j] == '?') {
-				flipCellFlag(i, j);
-			}
-		}
+	TRACE_SPAN("board", "clear flags");
+
+	for (int idx = flaggedBits.nextSet(0); idx >= 0; 
+			idx = flaggedBits.nextSet(idx + 1)) {
+		markChanged(idx);
+	}
+	flagsRemaining += flaggedBits.count();
+	flagEdits += 1;
+	flaggedBits.clear();
+}
+
+/**
+* 
+* const vector<pair<int, int>> &MinesweeperBoard::getChangedCells()
+* 
+* Summary: Returns the cells whose player board char changed since last call
+* 
+* Parameters:	none
+* 				
+* Returns:	    vector of int pairs - row and col of each changed cell. Only 
+*				valid until the next call.
+*
+* Description: Reveals, flags and revealMines all record the cells they 
+*	change, each cell once, so a display can redraw just those cells instead
+*	of the whole board. Reading the list empties it. After a reset every cell
+*	may have changed, so read the whole board with getPlayerBoard instead.
+*
+**/
+const vector<pair<int, int>> &MinesweeperBoard::getChangedCells()
+{
+	changedCoordinates.clear();
+	for (size_t i = 0; i < changedCells.size(); i++) {
+		changedBits.reset(changedCells[i]);
+		changedCoordinates.push_back(pair<int, int>(
+				changedCells[i] / stride - 1, changedCells[i] % stride - 1));
 	}
+	changedCells.clear();
+	return changedCoordinates;
 }
 
 /**
@@ -512,10 +1289,41 @@ void MinesweeperBoard::clearFlags()
 * 				
 * Returns:	    vector<vector<char>>
 *
+* Description: Builds a copy of the display chars for the playable cells. 
+*	Use getView to read the board without copying it.
+*
 **/
 vector<vector<char>> MinesweeperBoard::getPlayerBoard()
 {
-	return playerBoard;
+	MinesweeperBoardView view = getView();
+	vector<vector<char>> board(rows, vector<char>(cols));
+
+	for (int i = 0; i < rows; i++) {
+		for (int j = 0; j < cols; j++) {
+			board[i][j] = view(i, j);
+		}
+	}
+	return board;
+}
+
+/**
+* 
+* MinesweeperBoardView MinesweeperBoard::getView() const
+* 
+* Summary: Returns a read-only view of the player board
+* 
+* Parameters:	none
+* 				
+* Returns:	    MinesweeperBoardView
+*
+* Description: The view reads the board in place, so nothing is copied or
+*	allocated. It always shows the current state of the board and stays 
+*	valid until the board is destroyed.
+*
+**/
+MinesweeperBoardView MinesweeperBoard::getView() const
+{
+	return MinesweeperBoardView(*this);
 }
 
 /**
@@ -533,7 +1341,7 @@ vector<vector<char>> MinesweeperBoard::getPlayerBoard()
 char MinesweeperBoard::getPlayerBoardCell(int row, int col)
 {
 	if (isInBounds(row, col)) {
-		return playerBoard[row][col];
+		return playerCell(cellIndex(row, col));
 	}
 	return 0;
 }
@@ -554,6 +1362,99 @@ int MinesweeperBoard::getFlagsRemaining()
 	return flagsRemaining;
 }
 
+/**
+* 
+* int MinesweeperBoard::getRows()
+* 
+* Summary: Returns the number of rows on the board
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperBoard::getRows()
+{
+	return rows;
+}
+
+/**
+* 
+* int MinesweeperBoard::getCols()
+* 
+* Summary: Returns the number of cols on the board
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperBoard::getCols()
+{
+	return cols;
+}
+
+/**
+* 
+* uint64_t MinesweeperBoard::getSeed()
+* 
+* Summary: Returns the seed the current game was started from
+* 
+* Parameters:	none
+* 				
+* Returns:	    uint64_t - passing it to reset plays the same game again
+*
+**/
+uint64_t MinesweeperBoard::getSeed()
+{
+	return seed;
+}
+
+/**
+* 
+* bool MinesweeperBoard::getSafeOpening()
+* 
+* Summary: Returns whether the first reveal is always an opening
+* 
+* Parameters:	none
+* 				
+* Returns:	    bool
+*
+**/
+bool MinesweeperBoard::getSafeOpening()
+{
+	return safeOpening;
+}
+
+/**
+* 
+* uint64_t MinesweeperBoard::getPlayerHash()
+* 
+* Summary: Returns a hash of the player board
+* 
+* Parameters:	none
+* 				
+* Returns:	    uint64_t
+*
+* Description: Covers which cells are revealed and flagged, so two boards 
+*	with the same seed have the same hash only if they were played to the 
+*	same position. Used to check that a replay matches the recorded game.
+*
+**/
+uint64_t MinesweeperBoard::getPlayerHash()
+{
+	const uint64_t *revealedWords = revealedBits.getWords();
+	const uint64_t *flaggedWords = flaggedBits.getWords();
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	for (int i = 0; i < revealedBits.getWordCount(); i++) {
+		hash = (hash ^ revealedWords[i]) * 0x100000001b3ULL;
+		hash = (hash ^ flaggedWords[i]) * 0x100000001b3ULL;
+		hash ^= hash >> 32;
+	}
+	return hash;
+}
+
 /**
 * 
 * bool MinesweeperBoard::solvePuzzle()
@@ -578,61 +1479,47 @@ bool MinesweeperBoard::solvePuzzle()
 	bool moveMade = false;
 
 	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < cols; j++) {
+		int idx = cellIndex(i, 0);
+		for (int j = 0; j < cols; j++, idx++) {
 			int coveredNeighbors = 0, flaggedNeighbors = 0;
 
-			// if the cell hase been uncovered and is not a blank,
-			// count the neighboring cells that are either uncovered or a flag
-			if (playerBoard[i][j] != '-' && playerBoard[i][j] != ' ') {
-				for (size_t k = 0; k < neighborCellCoordinates.size(); k++) {
-					// iterate through all neighboring cells
-					int rowOffset = neighborCellCoordinates[k].first;
-					int colOffset = neighborCellCoordinates[k].second;
-					int neighborRow = i + rowOffset;
-					int neighborCol = j + colOffset;
-
-					if (isInBounds(neighborRow, neighborCol)) {
-						if (playerBoard[neighborRow][neighborCol] == '-') {
-							coveredNeighbors += 1;
-						}
-						if (playerBoard[neighborRow][neighborCol] == '?') {
-							flaggedNeighbors += 1;
-						}
+			// if the cell hase been uncovered and is a hint,
+			// count the neighboring cells that are either covered or a flag
+			if (revealedBits.test(idx) 
+					&& solutionBoard[idx] > '0' && solutionBoard[idx] < '9') {
+				int hint = solutionBoard[idx] - 48;
+
+				for (int k = 0; k < NEIGHBOR_COUNT; k++) {
+					int neighbor = idx + neighborCellOffsets[k];
+
+					if (flaggedBits.test(neighbor)) {
+						flaggedNeighbors += 1;
+					}
+					else if (!revealedBits.test(neighbor)) {
+						coveredNeighbors += 1;
 					}
 				}
 
 				// if # of covered neighbors + flag neighbors == self
 				// add flag to all covered neighbors
-				if (((int)playerBoard[i][j] - 48) == (
+				if (hint == (
 								coveredNeighbors + flaggedNeighbors)) {
-					for (size_t k = 0; k < neighborCellCoordinates.size(); k++) {
-						// iterate through all neighboring cells
-						int rowOffset = neighborCellCoordinates[k].first;
-						int colOffset = neighborCellCoordinates[k].second;
-						int neighborRow = i + rowOffset;
-						int neighborCol = j + colOffset;
-
-						if (isInBounds(neighborRow, neighborCol)) {
-							if(flagCell(neighborRow, neighborCol)) {
-								moveMade = true;
-							}
+					for (int k = 0; k < NEIGHBOR_COUNT; k++) {
+						if (flagIndex(idx + neighborCellOffsets[k])) {
+							moveMade = true;
 						}
 					}
 				}
 
 				// if # of flag neighbors == self
 				// reveal all covered neighbors
-				if (((int)playerBoard[i][j] - 48) == (flaggedNeighbors)) {
-					for (size_t k = 0; k < neighborCellCoordinates.size(); k++) {
-						// iterate through all neighboring cells
-						int rowOffset = neighborCellCoordinates[k].first;
-						int colOffset = neighborCellCoordinates[k].second;
-						int neighborRow = i + rowOffset;
-						int neighborCol = j + colOffset;
-
-						if (isInBounds(neighborRow, neighborCol)
-								&& playerBoard[neighborRow][neighborCol] == '-') {
-							revealCell(neighborRow, neighborCol);
+				if (hint == flaggedNeighbors) {
+					for (int k = 0; k < NEIGHBOR_COUNT; k++) {
+						int neighbor = idx + neighborCellOffsets[k];
+
+						if (!revealedBits.test(neighbor) 
+								&& !flaggedBits.test(neighbor)) {
+							revealIndex(neighbor);
 							moveMade = true;
 						}
 					}
@@ -6,14 +6,29 @@
 #ifndef MINESWEEPER_BOARD_HPP
 #define MINESWEEPER_BOARD_HPP
 
+#include <cstdint>
+#include <utility>	// pair
 #include <vector>
+#include "MinesweeperBitboard.hpp"
 #include "MinesweeperGameStatus.hpp"
+#include "MinesweeperRandom.hpp"
+
+class MinesweeperBoardView;
+class MinesweeperSnapshot;
 
 class MinesweeperBoard
 {
+	friend class MinesweeperSolver;
+	friend class MinesweeperBoardView;
+	friend class MinesweeperSnapshot;
+
 	public:
-		MinesweeperBoard(int, int, int);
+		MinesweeperBoard(int, int, int, uint64_t);
 		~MinesweeperBoard();
+
+		void reset(int, int, int, uint64_t);
+		bool restore(const MinesweeperSnapshot &);
+		void setSafeOpening(bool);
 		
 		// game checks
 		bool isInBounds(int, int);
@@ -21,8 +36,8 @@ class MinesweeperBoard
 		bool verifyFlags();
 
 		// setters (modify board)
-		void revealCell(int, int);
-		void revealRandomCell();
+		const std::vector<std::pair<int, int>> &revealCell(int, int);
+		const std::vector<std::pair<int, int>> &revealRandomCell();
 		void revealMines();
 		bool flagCell(int, int);
 		bool unflagCell(int, int);
@@ -31,24 +46,90 @@ class MinesweeperBoard
 
 		// getters
 		std::vector<std::vector<char>> getPlayerBoard();
+		MinesweeperBoardView getView() const;
 		char getPlayerBoardCell(int, int);
+		const std::vector<std::pair<int, int>> &getChangedCells();
+		int getRows();
+		int getCols();
 		int getFlagsRemaining();
+		uint64_t getSeed();
+		bool getSafeOpening();
+		uint64_t getPlayerHash();
 
 		// solver
 		bool solvePuzzle();
 
 	private:
+		static const int NEIGHBOR_COUNT = 8;
+
 		int rows, cols, mines, flagsRemaining;
-		std::vector<std::vector<char>> solutionBoard;
-		std::vector<std::vector<char>> playerBoard;
-		std::vector<std::pair<int, int>> mineCoordinates;
-		std::vector<std::pair<int, int>> neighborCellCoordinates;
+		int stride;		// row length of the padded boards (cols + 2)
+		int borderCells;
+		int revealedCount;	// playable cells uncovered so far
+		bool mineHit;
+		int flagEdits;		// bumped whenever any flag changes
+		uint64_t seed;		// seed the current game was started from
+		bool safeOpening;	// place mines after the first reveal, away from it
+		bool minesPlaced;
+		MinesweeperRandom random;
+		std::vector<char> solutionBoard;
+		std::vector<char> mineBytes;	// 1 for a mine, 0 otherwise
+		MinesweeperBitboard mineBits, revealedBits, flaggedBits;
+		MinesweeperBitboard changedBits;	// cells in changedCells
+		std::vector<int> changedCells;		// player cells changed since read
+		std::vector<std::pair<int, int>> changedCoordinates;
+		std::vector<int> mineCells;
+		std::vector<int> revealQueue;		// flood fill work queue
+		std::vector<int> revealedCells;		// cells uncovered by last reveal
+		std::vector<int> revealLog;			// all cells in order uncovered
+		std::vector<std::pair<int, int>> revealedCoordinates;
+		int neighborCellOffsets[NEIGHBOR_COUNT];
 
 		// helper functions
-		void initializeVect(std::vector<std::vector<char>> &, int, int, char);
-		void setNeighborCellCoordinates();
-		void setMines();
+		int cellIndex(int, int) const;
+		void initializeVect(std::vector<char> &, char, char);
+		void initializeBits();
+		static bool validSnapshot(const MinesweeperSnapshot &);
+		void setNeighborCellOffsets();
+		void setMines(int);
+		int setExclusionZone(int, int *);
+		int candidateIndex(int, const int *, int);
+		void placeMine(int);
+		void shuffleMines(int, const int *, int);
+		void sampleMines(int, const int *, int);
 		void setHints();
+		void revealIndex(int);
+		template <int> void floodFill();
+		void openIndex(int);
+		const std::vector<std::pair<int, int>> &getRevealedCoordinates();
+		bool flagIndex(int);
+		void markChanged(int);
+		char playerCell(int) const;
+		template <int> bool checkFlagCounts();
+		Status scanGameState();
+		bool scanHints();
 };
 
-#endif
\ No newline at end of file
+// converts board coordinates to an index into the padded boards
+inline int MinesweeperBoard::cellIndex(int row, int col) const
+{
+	return (row + 1) * stride + (col + 1);
+}
+
+// display char of a cell: '?' flagged, '-' covered, ' ' blank, '*' mine or 
+// '1'-'8' hint
+inline char MinesweeperBoard::playerCell(int idx) const
+{
+	if (flaggedBits.test(idx)) {
+		return '?';
+	}
+	if (!revealedBits.test(idx)) {
+		return '-';
+	}
+	if (solutionBoard[idx] == '0') {
+		return ' ';
+	}
+	return solutionBoard[idx];
+}
+
+#endif
@@ -0,0 +1,39 @@
+/*******************************************************************************
+ * 
+ * File:	MinesweeperBoardView.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ * 
+ * Description: Implementation file for the MinesweeperBoardView class. A 
+ *	read-only window onto a MinesweeperBoard's player board. It holds only a
+ *	pointer to the board, so it is cheap to pass by value, and each cell's 
+ *	display char is worked out from the board's bitboards when it is read.
+ * 
+ ******************************************************************************/
+#include "MinesweeperBoardView.hpp"
+
+/**
+* 
+* MinesweeperBoardView::MinesweeperBoardView(const MinesweeperBoard &board) 
+* 
+* Summary: Constructor
+* 
+* Parameters:	MinesweeperBoard to view, which must outlive the view
+* 				
+**/
+MinesweeperBoardView::MinesweeperBoardView(const MinesweeperBoard &board) 
+{
+	this->board = &board;
+}
+
+/**
+* 
+* MinesweeperBoardView::~MinesweeperBoardView() 
+* 
+* Summary: Destructor
+* 
+**/
+MinesweeperBoardView::~MinesweeperBoardView() 
+{
+
+}
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* File:		MinesweeperBoardView.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_BOARD_VIEW_HPP
+#define MINESWEEPER_BOARD_VIEW_HPP
+
+#include "MinesweeperBoard.hpp"
+
+class MinesweeperBoardView
+{
+	public:
+		MinesweeperBoardView(const MinesweeperBoard &);
+		~MinesweeperBoardView();
+
+		// getters
+		int rows() const;
+		int cols() const;
+		char operator()(int, int) const;
+
+	private:
+		const MinesweeperBoard *board;
+};
+
+inline int MinesweeperBoardView::rows() const
+{
+	return board->rows;
+}
+
+inline int MinesweeperBoardView::cols() const
+{
+	return board->cols;
+}
+
+// display char of a cell, see MinesweeperBoard::playerCell. The row and col
+// are not bounds checked.
+inline char MinesweeperBoardView::operator()(int row, int col) const
+{
+	return board->playerCell(board->cellIndex(row, col));
+}
+
+#endif
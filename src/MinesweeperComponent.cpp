@@ -0,0 +1,435 @@
+/*******************************************************************************
+ * 
+ * File:	MinesweeperComponent.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ * 
+ * Description: Implementation file for the MinesweeperComponent class. A
+ *	component is a group of covered frontier cells that are linked by shared 
+ *	hint constraints. Components don't affect each other except through the 
+ *	total number of mines, so each one can be enumerated on its own.
+ * 
+ ******************************************************************************/
+#include <stddef.h>		// size_t
+#include "MinesweeperComponent.hpp"
+
+using std::vector;
+
+/**
+* 
+* MinesweeperComponent::MinesweeperComponent() 
+* 
+* Summary: Constructor
+* 
+**/
+MinesweeperComponent::MinesweeperComponent() 
+{
+	nodes = 0;
+	nodeBudget = 0;
+	constraintStart.push_back(0);
+}
+
+/**
+* 
+* MinesweeperComponent::~MinesweeperComponent() 
+* 
+* Summary: Destructor
+* 
+**/
+MinesweeperComponent::~MinesweeperComponent() 
+{
+
+}
+
+/**
+* 
+* void MinesweeperComponent::clear()
+* 
+* Summary: Removes all cells and constraints so the component can be reused
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperComponent::clear()
+{
+	cells.clear();
+	constraintMines.clear();
+	constraintStart.resize(1);
+	constraintCells.clear();
+}
+
+/**
+* 
+* int MinesweeperComponent::addCell(int idx)
+* 
+* Summary: Adds a covered cell to the component
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    int for the cell's number within the component
+*
+**/
+int MinesweeperComponent::addCell(int idx)
+{
+	cells.push_back(idx);
+	return cells.size() - 1;
+}
+
+/**
+* 
+* void MinesweeperComponent::addConstraint(const int *localCells, int count,
+*		int mines)
+* 
+* Summary: Adds a hint constraint to the component
+* 
+* Parameters:	int array of the component cell numbers the hint covers
+*				int for the number of cells in the array
+*				int for the number of mines that must be in those cells
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperComponent::addConstraint(const int *localCells, int count,
+		int mines)
+{
+	constraintMines.push_back(mines);
+	constraintCells.insert(constraintCells.end(), localCells, 
+			localCells + count);
+	constraintStart.push_back(constraintCells.size());
+}
+
+/**
+* 
+* bool MinesweeperComponent::enumerate(long budget)
+* 
+* Summary: Counts every arrangement of mines that satisfies all constraints
+* 
+* Parameters:	long for the most search nodes to visit before giving up
+* 				
+* Returns:	    bool - true if the search finished within the budget
+*
+* Description: Uses backtracking to try every arrangement. For each total 
+*	number of mines it records how many arrangements there are and, for each 
+*	cell, how many of those arrangements have a mine in that cell. Counts are
+*	scaled so they add up to 1, which keeps them in range when components are
+*	multiplied together and doesn't change any probability.
+*
+**/
+bool MinesweeperComponent::enumerate(long budget)
+{
+	int cellCount = cells.size();
+
+	nodes = 0;
+	nodeBudget = budget;
+	configCounts.assign(cellCount + 1, 0);
+	cellMineCounts.assign((cellCount + 1) * cellCount, 0);
+	assignment.assign(cellCount, 0);
+	constraintAssigned.assign(constraintMines.size(), 0);
+	constraintOpen.resize(constraintMines.size());
+	for (size_t c = 0; c < constraintMines.size(); c++) {
+		constraintOpen[c] = constraintStart[c + 1] - constraintStart[c];
+	}
+	setCellConstraints();
+	setOrder();
+
+	if (!search(0, 0)) {
+		return false;
+	}
+	normalize();
+	return true;
+}
+
+/**
+* 
+* void MinesweeperComponent::setCellConstraints()
+* 
+* Summary: Builds the list of constraints each cell belongs to
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperComponent::setCellConstraints()
+{
+	int cellCount = cells.size();
+
+	// count constraints per cell, then turn the counts into start offsets
+	cellConstraintStart.assign(cellCount + 1, 0);
+	for (size_t i = 0; i < constraintCells.size(); i++) {
+		cellConstraintStart[constraintCells[i] + 1] += 1;
+	}
+	for (int i = 0; i < cellCount; i++) {
+		cellConstraintStart[i + 1] += cellConstraintStart[i];
+	}
+
+	// fill in each cell's constraints, using order as the write positions
+	cellConstraints.resize(constraintCells.size());
+	order.assign(cellConstraintStart.begin(), cellConstraintStart.end() - 1);
+	for (size_t c = 0; c < constraintMines.size(); c++) {
+		for (int i = constraintStart[c]; i < constraintStart[c + 1]; i++) {
+			cellConstraints[order[constraintCells[i]]++] = c;
+		}
+	}
+}
+
+/**
+* 
+* void MinesweeperComponent::setOrder()
+* 
+* Summary: Picks the order cells are assigned in during the search
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Walks the cells breadth first through shared constraints so
+*	that constraints fill up early and bad branches are cut off sooner.
+*
+**/
+void MinesweeperComponent::setOrder()
+{
+	int cellCount = cells.size();
+
+	seen.assign(cellCount, 0);
+	order.clear();
+	for (int start = 0; start < cellCount; start++) {
+		if (seen[start]) {
+			continue;
+		}
+		seen[start] = 1;
+		order.push_back(start);
+
+		for (size_t head = order.size() - 1; head < order.size(); head++) {
+			int cell = order[head];
+			for (int i = cellConstraintStart[cell]; 
+					i < cellConstraintStart[cell + 1]; i++) {
+				int c = cellConstraints[i];
+				for (int k = constraintStart[c]; k < constraintStart[c + 1]; 
+						k++) {
+					int linked = constraintCells[k];
+					if (!seen[linked]) {
+						seen[linked] = 1;
+						order.push_back(linked);
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+* 
+* bool MinesweeperComponent::assignCell(int cell, int value)
+* 
+* Summary: Assigns a cell and checks every constraint it belongs to
+* 
+* Parameters:	int for the component cell number
+*				int for the value (1 for mine, 0 for safe)
+* 				
+* Returns:	    bool - true if every constraint can still be satisfied
+*
+* Description: The assignment is always applied, call unassignCell to undo it
+*	even if this returns false.
+*
+**/
+bool MinesweeperComponent::assignCell(int cell, int value)
+{
+	bool valid = true;
+
+	assignment[cell] = value;
+	for (int i = cellConstraintStart[cell]; i < cellConstraintStart[cell + 1]; 
+			i++) {
+		int c = cellConstraints[i];
+		constraintAssigned[c] += value;
+		constraintOpen[c] -= 1;
+
+		if (constraintAssigned[c] > constraintMines[c] 
+				|| constraintAssigned[c] + constraintOpen[c] 
+					< constraintMines[c]) {
+			valid = false;
+		}
+	}
+	return valid;
+}
+
+/**
+* 
+* void MinesweeperComponent::unassignCell(int cell, int value)
+* 
+* Summary: Undoes assignCell
+* 
+* Parameters:	int for the component cell number
+*				int for the value that was assigned
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperComponent::unassignCell(int cell, int value)
+{
+	assignment[cell] = 0;
+	for (int i = cellConstraintStart[cell]; i < cellConstraintStart[cell + 1]; 
+			i++) {
+		constraintAssigned[cellConstraints[i]] -= value;
+		constraintOpen[cellConstraints[i]] += 1;
+	}
+}
+
+/**
+* 
+* bool MinesweeperComponent::search(int depth, int minesPlaced)
+* 
+* Summary: Recursive backtracking search over the cells in order
+* 
+* Parameters:	int for the number of cells assigned so far
+*				int for the number of mines placed so far
+* 				
+* Returns:	    bool - false if the node budget ran out
+*
+**/
+bool MinesweeperComponent::search(int depth, int minesPlaced)
+{
+	int cellCount = cells.size();
+
+	if (++nodes > nodeBudget) {
+		return false;
+	}
+
+	if (depth == cellCount) {
+		// every constraint is satisfied, record the arrangement
+		configCounts[minesPlaced] += 1;
+		double *counts = &cellMineCounts[minesPlaced * cellCount];
+		for (int i = 0; i < cellCount; i++) {
+			counts[i] += assignment[i];
+		}
+		return true;
+	}
+
+	int cell = order[depth];
+	for (int value = 0; value <= 1; value++) {
+		bool finished = true;
+
+		if (assignCell(cell, value)) {
+			finished = search(depth + 1, minesPlaced + value);
+		}
+		unassignCell(cell, value);
+
+		if (!finished) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* 
+* void MinesweeperComponent::normalize()
+* 
+* Summary: Scales all counts so the arrangement counts add up to 1
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperComponent::normalize()
+{
+	double total = 0;
+
+	for (size_t i = 0; i < configCounts.size(); i++) {
+		total += configCounts[i];
+	}
+	if (total == 0) {
+		return;
+	}
+	for (size_t i = 0; i < configCounts.size(); i++) {
+		configCounts[i] /= total;
+	}
+	for (size_t i = 0; i < cellMineCounts.size(); i++) {
+		cellMineCounts[i] /= total;
+	}
+}
+
+/**
+* 
+* int MinesweeperComponent::getCellCount()
+* 
+* Summary: Returns the number of cells in the component
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperComponent::getCellCount()
+{
+	return cells.size();
+}
+
+/**
+* 
+* int MinesweeperComponent::getCell(int cell)
+* 
+* Summary: Returns the padded board index of a component cell
+* 
+* Parameters:	int for the component cell number
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperComponent::getCell(int cell)
+{
+	return cells[cell];
+}
+
+/**
+* 
+* int MinesweeperComponent::getMaxMines()
+* 
+* Summary: Returns the most mines the component could hold
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperComponent::getMaxMines()
+{
+	return cells.size();
+}
+
+/**
+* 
+* double MinesweeperComponent::getConfigCount(int mines)
+* 
+* Summary: Returns the (scaled) number of arrangements with a mine count
+* 
+* Parameters:	int for the total number of mines in the component
+* 				
+* Returns:	    double
+*
+**/
+double MinesweeperComponent::getConfigCount(int mines)
+{
+	return configCounts[mines];
+}
+
+/**
+* 
+* double MinesweeperComponent::getCellMineCount(int mines, int cell)
+* 
+* Summary: Returns the (scaled) number of arrangements with a mine count that
+*	have a mine in a cell
+* 
+* Parameters:	int for the total number of mines in the component
+*				int for the component cell number
+* 				
+* Returns:	    double
+*
+**/
+double MinesweeperComponent::getCellMineCount(int mines, int cell)
+{
+	return cellMineCounts[mines * cells.size() + cell];
+}
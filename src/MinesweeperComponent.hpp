@@ -0,0 +1,60 @@
+/*******************************************************************************
+* File:		MinesweeperComponent.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_COMPONENT_HPP
+#define MINESWEEPER_COMPONENT_HPP
+
+#include <vector>
+
+class MinesweeperComponent
+{
+	public:
+		MinesweeperComponent();
+		~MinesweeperComponent();
+
+		// setters
+		void clear();
+		int addCell(int);
+		void addConstraint(const int *, int, int);
+
+		// solver
+		bool enumerate(long);
+
+		// getters
+		int getCellCount();
+		int getCell(int);
+		int getMaxMines();
+		double getConfigCount(int);
+		double getCellMineCount(int, int);
+
+	private:
+		// constraints and the constraints of each cell are stored as flat 
+		// lists with start offsets so that clearing the component for reuse 
+		// keeps every buffer
+		std::vector<int> cells;					// padded board index per cell
+		std::vector<int> constraintMines;
+		std::vector<int> constraintStart;		// into constraintCells
+		std::vector<int> constraintCells;
+		std::vector<int> cellConstraintStart;	// into cellConstraints
+		std::vector<int> cellConstraints;
+		std::vector<int> constraintAssigned;	// mines placed so far
+		std::vector<int> constraintOpen;		// cells not yet assigned
+		std::vector<int> order;					// order cells are assigned
+		std::vector<char> assignment;
+		std::vector<char> seen;
+		std::vector<double> configCounts;		// [mines]
+		std::vector<double> cellMineCounts;		// [mines * cellCount + cell]
+		long nodes, nodeBudget;
+
+		// helper functions
+		void setCellConstraints();
+		void setOrder();
+		bool assignCell(int, int);
+		void unassignCell(int, int);
+		bool search(int, int);
+		void normalize();
+};
+
+#endif
@@ -10,54 +10,237 @@
  * 
  ******************************************************************************/
 #include <stddef.h>		// size_t
+#include <algorithm>	// sort, min, max
+#include <cstdint>
 #include "MinesweeperDisplay.hpp"
 #include "minesweeperMenus.hpp"
+#include "minesweeperStats.hpp"
+#include "minesweeperTrace.hpp"
 
 using std::vector;
 
+static const int MIN_VIEW_ROWS = 5;		// smallest view on a tiny terminal
+static const int MIN_VIEW_COLS = 10;
+static const int MINIMAP_ROWS = 16;		// largest minimap
+static const int MINIMAP_COLS = 32;
+static const int GAME_MESSAGE_HEIGHT = 15;
+
 /**
 * 
-* MinesweeperDisplay::MinesweeperDisplay(int rows, int cols, int mines) 
+* MinesweeperDisplay::MinesweeperDisplay(int rows, int cols) 
 * 
 * Summary: Constructor
 * 
 * Parameters:	int for board rows
 *				int for board cols
-*				int for number of mines
+*
+* Description: A board that doesn't fit the terminal is shown through a view
+*	that follows the cursor, with a minimap of the whole board beside it. 
+*	Only the cells in view are ever drawn, so drawing costs the same on a 
+*	1000x1000 board as on one that fits the screen.
 * 				
 **/
 MinesweeperDisplay::MinesweeperDisplay(int rows, int cols) 
 {
-	this->rows = rows;
-	this->cols = cols;
-	cursorRow = 0;
-	cursorCol = 0;
 	topBorder = 1;
 	bottomBorder = 1;
 	leftBorder = 2;
 	rightBorder = 1;
 	rowDisplayOffset = 0;
 	colDisplayOffset = 2;
+	gameBoardWin = timerWin = flagsWin = gameMessageWin = nullptr;
+	minimapWin = nullptr;
 	
 	// start ncurses mode
 	initscr();
 	noecho();
 	cbreak();
 
-	// create game board window
-	int gameBoardWinHeight = rows + topBorder + bottomBorder;
-	int gameBoardWinWidth = (cols * colDisplayOffset) 
-									+ leftBorder + rightBorder;
-	int gameBoardWinStarty = 0;
-	// center the board using terminal window size
+	reset(rows, cols);
+}
+
+/**
+* 
+* MinesweeperDisplay::~MinesweeperDisplay() 
+* 
+* Summary: Destructor. Clears the screen and ends ncurses mode
+* 
+**/
+MinesweeperDisplay::~MinesweeperDisplay() 
+{
+	clearScreen();
+	deleteWindows();
+	endwin();	// end ncurses mode
+}
+
+/**
+* 
+* void MinesweeperDisplay::reset(int rows, int cols) 
+* 
+* Summary: Sets the display up for a new game
+* 
+* Parameters:	int for board rows
+*				int for board cols
+* 				
+* Returns:	    void
+*
+* Description: The view is sized to the terminal as it is now. When the 
+*	windows would come out the same size and in the same place as the last 
+*	game's they are cleared and kept, otherwise they are created again. The 
+*	frame buffers are reused, so nothing is allocated unless the board or 
+*	the view grows. Call printBoard afterwards.
+*
+**/
+void MinesweeperDisplay::reset(int rows, int cols) 
+{
+	this->rows = rows;
+	this->cols = cols;
+	cursorRow = 0;
+	cursorCol = 0;
+	boardFrame.assign((size_t)rows * cols, 0);	// nothing drawn yet
+
+	// size the view to the terminal, leaving room for the flags and timer 
+	// line, a blank line and the message window below the board
+	int winMaxy = getmaxy(stdscr);
 	int winMaxx = getmaxx(stdscr);
-	int gameBoardWinStartx = winMaxx / 2 - gameBoardWinWidth / 2;
+	int maxViewRows = winMaxy - topBorder - bottomBorder - 2 
+									- GAME_MESSAGE_HEIGHT;
+	int maxViewCols = (winMaxx - leftBorder - rightBorder) / colDisplayOffset;
+	minimapRows = 0;
+	minimapCols = 0;
+	if (rows > maxViewRows || cols > maxViewCols) {
+		minimapRows = std::min(rows, MINIMAP_ROWS);
+		minimapCols = std::min(cols, MINIMAP_COLS);
+		maxViewCols = (winMaxx - leftBorder - rightBorder - minimapCols - 3) 
+									/ colDisplayOffset;
+	}
+	viewRows = std::min(rows, std::max(maxViewRows, MIN_VIEW_ROWS));
+	viewCols = std::min(cols, std::max(maxViewCols, MIN_VIEW_COLS));
+	viewTop = 0;
+	viewLeft = 0;
+	minimapRows = std::min(minimapRows, viewRows);	// no taller than the view
+
+	shadowFrame.assign(viewRows * viewCols, 0);	// nothing drawn yet
+	dirtyFlags.assign(viewRows * viewCols, 0);
+	dirtyCells.clear();
+	dirtyCells.reserve(viewRows * viewCols);
+	runBuffer.reserve(viewCols * colDisplayOffset);
+
+	// center the board and minimap using terminal window size
+	int gameBoardWinHeight = viewRows + topBorder + bottomBorder;
+	int gameBoardWinWidth = (viewCols * colDisplayOffset) 
+									+ leftBorder + rightBorder;
+	int minimapWinWidth = minimapCols ? minimapCols + 2 : 0;
+	int gameBoardWinStartx = winMaxx / 2 - (gameBoardWinWidth 
+			+ (minimapCols ? minimapWinWidth + 1 : 0)) / 2;	// 1 col gap
 	if (gameBoardWinStartx < 0) {gameBoardWinStartx = 0;}
+
+	bool sameLayout = gameBoardWin 
+			&& getmaxy(gameBoardWin) == gameBoardWinHeight
+			&& getmaxx(gameBoardWin) == gameBoardWinWidth
+			&& getbegx(gameBoardWin) == gameBoardWinStartx
+			&& (minimapWin ? getmaxx(minimapWin) : 0) == minimapWinWidth
+			&& (minimapWin ? getmaxy(minimapWin) : 2) == minimapRows + 2;
+	if (sameLayout) {
+		clearScreen();
+		box(gameBoardWin, 0, 0);
+		if (minimapWin) {
+			box(minimapWin, 0, 0);
+		}
+	}
+	else {
+		deleteWindows();
+		createWindows(gameBoardWinHeight, gameBoardWinWidth, 
+				gameBoardWinStartx);
+	}
+
+	minimapChanged = false;
+	if (minimapCols) {
+		// block r covers board rows blockFirstRow[r] to blockFirstRow[r+1]
+		blockFirstRow.resize(minimapRows + 1);
+		for (int r = 0; r <= minimapRows; r++) {
+			blockFirstRow[r] = (int)(((int64_t)r * rows + minimapRows - 1) 
+					/ minimapRows);
+		}
+		blockFirstCol.resize(minimapCols + 1);
+		for (int c = 0; c <= minimapCols; c++) {
+			blockFirstCol[c] = (int)(((int64_t)c * cols + minimapCols - 1) 
+					/ minimapCols);
+		}
+		blockUncovered.assign(minimapRows * minimapCols, 0);
+		minimapChanged = true;
+	}
+}
+
+/**
+* 
+* void MinesweeperDisplay::clearScreen() 
+* 
+* Summary: Clears every window from the screen
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: The windows are kept, so the display can be reset for another
+*	game. Call when the game is over and something else is about to use the 
+*	screen, such as the menu.
+*
+**/
+void MinesweeperDisplay::clearScreen() 
+{
+	wclear(gameBoardWin);
+	wclear(timerWin);
+	wclear(flagsWin);
+	wclear(gameMessageWin);
+
+	wrefresh(gameBoardWin);
+	wrefresh(timerWin);
+	wrefresh(flagsWin);
+	wrefresh(gameMessageWin);
+
+	if (minimapWin) {
+		wclear(minimapWin);
+		wrefresh(minimapWin);
+	}
+}
+
+/**
+* 
+* void MinesweeperDisplay::createWindows(int gameBoardWinHeight, 
+*		int gameBoardWinWidth, int gameBoardWinStartx) 
+* 
+* Summary: Creates the board, minimap, flags, timer and message windows
+* 
+* Parameters:	int for the height of the game board window
+*				int for the width of the game board window
+*				int for the screen col of the game board window
+* 				
+* Returns:	    void
+*
+* Description: The other windows are placed around the game board window. 
+*	The minimap window is only created when minimapCols is set.
+*
+**/
+void MinesweeperDisplay::createWindows(int gameBoardWinHeight, 
+		int gameBoardWinWidth, int gameBoardWinStartx) 
+{
+	// create game board window
+	int gameBoardWinStarty = 0;
 	this->gameBoardWin = newwin(gameBoardWinHeight, gameBoardWinWidth, 
 							gameBoardWinStarty, gameBoardWinStartx);
 	keypad(gameBoardWin, true);
 	box(gameBoardWin, 0, 0);
 
+	// create minimap window to the right of the board
+	this->minimapWin = nullptr;
+	if (minimapCols) {
+		this->minimapWin = newwin(minimapRows + 2, minimapCols + 2, 
+				gameBoardWinStarty, 
+				gameBoardWinStartx + gameBoardWinWidth + 1);
+		box(minimapWin, 0, 0);
+	}
+
 	// create flags display window
 	int flagsWinHeight = 1;
 	int flagsWinWidth = 5;
@@ -75,40 +258,40 @@ MinesweeperDisplay::MinesweeperDisplay(int rows, int cols)
 								timerWinStartx);
 
 	// create message window
-	int gameMessageWinHeight = 15;
 	int gameMessageWinWidth = 100;
 	int gameMessageWinStarty = flagsWinStarty + flagsWinHeight + 1;
 	int gameMessageWinStartx = gameBoardWinStartx + 1;
-	this->gameMessageWin = newwin(gameMessageWinHeight, gameMessageWinWidth, 
+	this->gameMessageWin = newwin(GAME_MESSAGE_HEIGHT, gameMessageWinWidth, 
 							gameMessageWinStarty, gameMessageWinStartx);
 	keypad(gameMessageWin, true);
 }
 
 /**
 * 
-* MinesweeperDisplay::~MinesweeperDisplay() 
+* void MinesweeperDisplay::deleteWindows() 
 * 
-* Summary: Destructor
+* Summary: Deletes the windows made by createWindows, if there are any
 * 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
 **/
-MinesweeperDisplay::~MinesweeperDisplay() 
+void MinesweeperDisplay::deleteWindows() 
 {
-	wclear(gameBoardWin);
-	wclear(timerWin);
-	wclear(flagsWin);
-	wclear(gameMessageWin);
-
-	wrefresh(gameBoardWin);
-	wrefresh(timerWin);
-	wrefresh(flagsWin);
-	wrefresh(gameMessageWin);
+	if (!gameBoardWin) {
+		return;
+	}
 
 	delwin(gameBoardWin);
 	delwin(timerWin);
 	delwin(flagsWin);
 	delwin(gameMessageWin);
-
-	endwin();	// end ncurses mode
+	if (minimapWin) {
+		delwin(minimapWin);
+	}
+	gameBoardWin = timerWin = flagsWin = gameMessageWin = nullptr;
+	minimapWin = nullptr;
 }
 
 /**
@@ -129,62 +312,358 @@ int MinesweeperDisplay::getUserInput()
 
 /**
 * 
-* void MinesweeperDisplay::printBoard(const vector<vector<char>> &vect)
+* int MinesweeperDisplay::getPendingInput()
+* 
+* Summary: Returns keyboard input from the game board without waiting
+* 
+* Parameters:	none
+* 				
+* Returns:	    int - a key, or ERR if no key is waiting
+*
+* Description: Used when an event loop has seen input arrive. Keys that 
+*	arrived together (such as a paste) may all be buffered by ncurses, so call
+*	it until it returns ERR.
+*
+**/
+int MinesweeperDisplay::getPendingInput()
+{
+	nodelay(gameBoardWin, true);
+	int ch = wgetch(gameBoardWin);
+	nodelay(gameBoardWin, false);
+	return ch;
+}
+
+/**
+* 
+* void MinesweeperDisplay::printBoard(const MinesweeperBoardView &board)
 * 
-* Summary: Prints a 2D vector to the game board window.
+* Summary: Prints a board to the game board window.
 * 
-* Parameters:	vector of vector of char
+* Parameters:	MinesweeperBoardView of the player board
 * 				
 * Returns:	    void
 *
-* Description: Ncurses is not thread safe - the work around used here is to
-*	limit printing to the display to one thread at a time using a mutex.
+* Description: Every cell is stored, but only cells in view that differ from
+*	what is already on the screen are drawn, see printBoardChanges.
 *
 **/
-void MinesweeperDisplay::printBoard(const vector<vector<char>> &vect)
+void MinesweeperDisplay::printBoard(const MinesweeperBoardView &board)
 {
-	displayMtx.lock();
-	for (int i = 0; i < rows; i++) {
-		for (int j = 0; j < cols; j++) {
-			if (vect[i][j] == '?') {
-				wattron(gameBoardWin, A_REVERSE);	// invert color for flags
-			}
-			mvwprintw(gameBoardWin, i + topBorder, 
-						(j * colDisplayOffset) + leftBorder,
-						"%c",
-						vect[i][j]);
+	TRACE_SPAN("render", "board");
 
-			if (vect[i][j] == '?') {
-				wattroff(gameBoardWin, A_REVERSE);	// turn off invert color
-			}
+	for (int i = 0; i < board.rows(); i++) {
+		for (int j = 0; j < board.cols(); j++) {
+			setFrameCell(i, j, board(i, j));
 		}
 	}
-	displayMtx.unlock();
+	markViewport();
+	printBoardChanges();
+}
+
+/**
+* 
+* void MinesweeperDisplay::setBoardCell(int row, int col, char value)
+* 
+* Summary: Sets the char a board cell should show
+* 
+* Parameters:	int for the row
+*				int for the col
+*				char for the cell
+* 				
+* Returns:	    void
+*
+* Description: Nothing is drawn until printBoardChanges is called. A cell 
+*	out of view is drawn when it is scrolled to.
+*
+**/
+void MinesweeperDisplay::setBoardCell(int row, int col, char value)
+{
+	setFrameCell(row, col, value);
+	if (row >= viewTop && row < viewTop + viewRows 
+			&& col >= viewLeft && col < viewLeft + viewCols) {
+		markViewCell((row - viewTop) * viewCols + col - viewLeft);
+	}
+}
+
+/**
+* 
+* void MinesweeperDisplay::printBoardChanges()
+* 
+* Summary: Draws the board cells that changed since they were last drawn
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Draws the changed cells in view and updates the minimap.
+*
+**/
+void MinesweeperDisplay::printBoardChanges()
+{
+	STATS_TIMER(DRAW_TIMER);
+	TRACE_SPAN("render", "board changes");
+
+	drawViewChanges();
+	printMinimap();
 	setCursorPosition(cursorRow, cursorCol);	// return cursor after printing
 }
 
 /**
 * 
-* void MinesweeperDisplay::printFlags(int flagCount)
+* void MinesweeperDisplay::setFrameCell(int row, int col, char value)
 * 
-* Summary: Moves the cursor to a position on the board
+* Summary: Stores the char a board cell should show
 * 
 * Parameters:	int for the row
 *				int for the col
+*				char for the cell
 * 				
 * Returns:	    void
 *
-* Description: Ncurses is not thread safe - the work around used here is to
-*	limit printing to the display to one thread at a time using a mutex.
+* Description: Keeps the minimap's count of uncovered cells in each block up
+*	to date, so the minimap never has to scan the board.
+*
+**/
+void MinesweeperDisplay::setFrameCell(int row, int col, char value)
+{
+	char &frame = boardFrame[(size_t)row * cols + col];
+	bool wasUncovered = frame != 0 && frame != '-';
+	bool isUncovered = value != 0 && value != '-';
+
+	if (minimapWin && wasUncovered != isUncovered) {
+		int block = (int)((int64_t)row * minimapRows / rows) * minimapCols 
+				+ (int)((int64_t)col * minimapCols / cols);
+		blockUncovered[block] += isUncovered ? 1 : -1;
+		minimapChanged = true;
+	}
+	frame = value;
+}
+
+/**
+* 
+* void MinesweeperDisplay::markViewCell(int cell)
+* 
+* Summary: Queues a cell in view to be compared with the screen
+* 
+* Parameters:	int for the cell, view row * view cols + view col
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperDisplay::markViewCell(int cell)
+{
+	if (!dirtyFlags[cell]) {
+		dirtyFlags[cell] = 1;
+		dirtyCells.push_back(cell);
+	}
+}
+
+/**
+* 
+* void MinesweeperDisplay::markViewport()
+* 
+* Summary: Queues every cell in view to be compared with the screen
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperDisplay::markViewport()
+{
+	for (int cell = 0; cell < viewRows * viewCols; cell++) {
+		markViewCell(cell);
+	}
+}
+
+/**
+* 
+* void MinesweeperDisplay::drawViewChanges()
+* 
+* Summary: Draws the queued cells in view that differ from the screen
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Compares the queued cells against a shadow copy of the 
+*	screen. Changed cells that sit next to each other in a row are drawn 
+*	together with a single write, so a typical move costs a few writes 
+*	instead of one per cell in view. The window isn't refreshed.
+*
+**/
+void MinesweeperDisplay::drawViewChanges()
+{
+	auto frameValue = [this](int cell) {
+		return boardFrame[(size_t)(viewTop + cell / viewCols) * cols 
+				+ viewLeft + cell % viewCols];
+	};
+
+	std::sort(dirtyCells.begin(), dirtyCells.end());
+
+	size_t i = 0;
+	while (i < dirtyCells.size()) {
+		int first = dirtyCells[i++];
+		dirtyFlags[first] = 0;
+		char value = frameValue(first);
+		if (value == shadowFrame[first]) {
+			continue;
+		}
+
+		// extend the run while the next changed cell is beside the last one
+		int last = first;
+		runBuffer.clear();
+		runBuffer.push_back(boardGlyph(value));
+		shadowFrame[first] = value;
+
+		while (i < dirtyCells.size() && dirtyCells[i] == last + 1 
+				&& dirtyCells[i] % viewCols != 0
+				&& frameValue(dirtyCells[i]) != shadowFrame[dirtyCells[i]]) {
+			last = dirtyCells[i++];
+			dirtyFlags[last] = 0;
+			value = frameValue(last);
+			for (int k = 1; k < colDisplayOffset; k++) {
+				runBuffer.push_back(' ');
+			}
+			runBuffer.push_back(boardGlyph(value));
+			shadowFrame[last] = value;
+		}
+
+		mvwaddchnstr(gameBoardWin, first / viewCols + topBorder, 
+				(first % viewCols) * colDisplayOffset + leftBorder,
+				runBuffer.data(), runBuffer.size());
+		STATS_ADD(CELLS_WRITTEN, last - first + 1);
+	}
+	dirtyCells.clear();
+}
+
+/**
+* 
+* bool MinesweeperDisplay::scrollToCursor()
+* 
+* Summary: Moves the view just far enough to show the cursor
+* 
+* Parameters:	none
+* 				
+* Returns:	    bool - true if the view moved
+*
+**/
+bool MinesweeperDisplay::scrollToCursor()
+{
+	int top = viewTop;
+	int left = viewLeft;
+
+	if (cursorRow < viewTop) {
+		viewTop = cursorRow;
+	}
+	else if (cursorRow >= viewTop + viewRows) {
+		viewTop = cursorRow - viewRows + 1;
+	}
+	if (cursorCol < viewLeft) {
+		viewLeft = cursorCol;
+	}
+	else if (cursorCol >= viewLeft + viewCols) {
+		viewLeft = cursorCol - viewCols + 1;
+	}
+	return viewTop != top || viewLeft != left;
+}
+
+/**
+* 
+* void MinesweeperDisplay::printMinimap()
+* 
+* Summary: Redraws the minimap if the board or the view changed
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Each minimap cell is '-' for a block that is still covered,
+*	'.' for one that is partly uncovered and blank for one that is fully 
+*	uncovered. The blocks in view are highlighted.
+*
+**/
+void MinesweeperDisplay::printMinimap()
+{
+	if (!minimapWin || !minimapChanged) {
+		return;
+	}
+
+	for (int r = 0; r < minimapRows; r++) {
+		bool rowInView = blockFirstRow[r] < viewTop + viewRows 
+				&& blockFirstRow[r + 1] > viewTop;
+		for (int c = 0; c < minimapCols; c++) {
+			bool inView = rowInView && blockFirstCol[c] < viewLeft + viewCols 
+					&& blockFirstCol[c + 1] > viewLeft;
+			mvwaddch(minimapWin, r + 1, c + 1, 
+					(chtype)minimapGlyph(r, c) | (inView ? A_REVERSE : 0));
+		}
+	}
+	wrefresh(minimapWin);
+	minimapChanged = false;
+}
+
+/**
+* 
+* char MinesweeperDisplay::minimapGlyph(int blockRow, int blockCol)
+* 
+* Summary: Returns the char a minimap cell shows
+* 
+* Parameters:	int for the minimap row
+*				int for the minimap col
+* 				
+* Returns:	    char
+*
+**/
+char MinesweeperDisplay::minimapGlyph(int blockRow, int blockCol)
+{
+	int total = (blockFirstRow[blockRow + 1] - blockFirstRow[blockRow]) 
+			* (blockFirstCol[blockCol + 1] - blockFirstCol[blockCol]);
+	int uncovered = blockUncovered[blockRow * minimapCols + blockCol];
+
+	if (uncovered == 0) {
+		return '-';
+	}
+	return uncovered == total ? ' ' : '.';
+}
+
+/**
+* 
+* chtype MinesweeperDisplay::boardGlyph(char value)
+* 
+* Summary: Returns the ncurses char to draw for a board cell
+* 
+* Parameters:	char for the cell
+* 				
+* Returns:	    chtype - flags are drawn in inverted color
+*
+**/
+chtype MinesweeperDisplay::boardGlyph(char value)
+{
+	if (value == '?') {
+		return (chtype)value | A_REVERSE;
+	}
+	return (chtype)value;
+}
+
+/**
+* 
+* void MinesweeperDisplay::printFlags(int flagCount)
+* 
+* Summary: Prints the number of flags remaining
+* 
+* Parameters:	int for the flag count
+* 				
+* Returns:	    void
 *
 **/
 void MinesweeperDisplay::printFlags(int flagCount)
 {
-	displayMtx.lock();
+	TRACE_SPAN("render", "flags");
+
 	wclear(flagsWin);
 	mvwprintw(flagsWin, 0, 0, "%d", flagCount);
 	wrefresh(flagsWin);
-	displayMtx.unlock();
 	setCursorPosition(cursorRow, cursorCol);
 }
 
@@ -200,14 +679,12 @@ void MinesweeperDisplay::printFlags(int flagCount)
 *
 * Description: Uses an offset so that the time is right aligned. Prints 9999
 * 	for all times > 9999.
-*	Ncurses is not thread safe - the work around used here is to
-*	limit printing to the display to one thread at a time using a mutex.
-*	This function uses a non-blocking try to lock mutex and will skip printing
-*	the updated time if locked.
 *
 **/
 void MinesweeperDisplay::printTime(int time)
 {
+	TRACE_SPAN("render", "time");
+
 	int digitCalc = time;
 	int timeOffset = 3;	// starting point for single digit number
 	while (digitCalc /= 10) {
@@ -219,14 +696,10 @@ void MinesweeperDisplay::printTime(int time)
 		time = 9999;
 	}
 
-	if (displayMtx.try_lock()) {	// skip updating if the mutex is locked
-		wclear(timerWin);
-		mvwprintw(timerWin, 0, timeOffset, "%d", time);
-		wrefresh(timerWin);
-		displayMtx.unlock();
-
-		setCursorPosition(cursorRow, cursorCol);
-	}
+	wclear(timerWin);
+	mvwprintw(timerWin, 0, timeOffset, "%d", time);
+	wrefresh(timerWin);
+	setCursorPosition(cursorRow, cursorCol);
 }
 
 /**
@@ -239,28 +712,31 @@ void MinesweeperDisplay::printTime(int time)
 * 				
 * Returns:	    void
 *
-* Description: The mutex is outside of the critical section here so the cursor
-*	stays put doesn't jump around. I'm sure this could be improved.
+* Description: Waits for enter (or q) before clearing the message, so 
+*	nothing else is handled while a message is showing.
 *
 **/
 void MinesweeperDisplay::printGameMessage(const char *message)
 {	
-	displayMtx.lock();
+	TRACE_SPAN("render", "message");
+
 	mvwprintw(gameMessageWin, 0, 0, message);
 	wprintw(gameMessageWin, "\n\n[press enter]");
 	
 	int ch;
-	while (1)	// hold screen until enter or q is pressed
 	{
-		ch = wgetch(gameMessageWin);
-		if (ch == 10 || ch == 'q') {
-			break;
+		TRACE_SPAN("input", "wait for enter");
+		while (1)	// hold screen until enter or q is pressed
+		{
+			ch = wgetch(gameMessageWin);
+			if (ch == 10 || ch == 'q') {
+				break;
+			}
 		}
 	}
 	
 	wclear(gameMessageWin);
 	wrefresh(gameMessageWin);
-	displayMtx.unlock();
 	setCursorPosition(cursorRow, cursorCol);
 }
 
@@ -275,18 +751,22 @@ void MinesweeperDisplay::printGameMessage(const char *message)
 * 				
 * Returns:	    void
 *
-* Description: Ncurses is not thread safe - the work around used here is to
-*	limit printing to the display to one thread at a time using a mutex.
+* Description: Scrolls the view if the cell is out of view.
 *
 **/
 void MinesweeperDisplay::setCursorPosition(int row, int col) 
 {
 	cursorRow = row;
 	cursorCol = col;
-	displayMtx.lock();
-	wmove(gameBoardWin, row + topBorder, col * colDisplayOffset + leftBorder);
+	if (scrollToCursor()) {
+		markViewport();
+		drawViewChanges();
+		minimapChanged = true;
+		printMinimap();
+	}
+	wmove(gameBoardWin, row - viewTop + topBorder, 
+			(col - viewLeft) * colDisplayOffset + leftBorder);
 	wrefresh(gameBoardWin);
-	displayMtx.unlock();
 }
 
 /**
@@ -8,7 +8,7 @@
 
 #include <ncurses.h>
 #include <vector>
-#include <mutex>
+#include "MinesweeperBoardView.hpp"
 
 class MinesweeperDisplay
 {
@@ -16,17 +16,23 @@ class MinesweeperDisplay
 		MinesweeperDisplay(int, int);
 		~MinesweeperDisplay();
 
+		void reset(int, int);
+		void clearScreen();
+
 		// input
 		int getUserInput();
+		int getPendingInput();
 
 		// output
-		void printBoard(const std::vector<std::vector<char>> &);
+		void printBoard(const MinesweeperBoardView &);
+		void printBoardChanges();
 		void printFlags(int);
 		void printTime(int);
 		void printGameMessage(const char*);
 
 		// setters
 		void setCursorPosition(int, int);
+		void setBoardCell(int, int, char);
 
 		// getters
 		int getCursorRow();
@@ -34,11 +40,39 @@ class MinesweeperDisplay
 
 	private:
 		int rows, cols;
+		int viewRows, viewCols;		// board cells that fit on screen
+		int viewTop, viewLeft;		// board cell at the top left of the view
 		int leftBorder, rightBorder, topBorder, bottomBorder;
 		int rowDisplayOffset, colDisplayOffset;	
 		int cursorRow, cursorCol;
 		WINDOW *gameBoardWin, *timerWin, *flagsWin, *gameMessageWin;
-		std::mutex displayMtx;
+		WINDOW *minimapWin;			// nullptr when the whole board fits
+
+		std::vector<char> boardFrame;	// what each board cell should show
+
+		// view frames, one char per visible cell in row-major order
+		std::vector<char> shadowFrame;	// what is on the screen
+		std::vector<char> dirtyFlags;	// cell is in dirtyCells
+		std::vector<int> dirtyCells;
+		std::vector<chtype> runBuffer;
+
+		// minimap, each minimap cell sums up a block of board cells
+		int minimapRows, minimapCols;
+		std::vector<int> blockFirstRow, blockFirstCol;
+		std::vector<int> blockUncovered;	// revealed or flagged cells
+		bool minimapChanged;
+
+		// helper functions
+		void createWindows(int, int, int);
+		void deleteWindows();
+		chtype boardGlyph(char);
+		void setFrameCell(int, int, char);
+		void markViewCell(int);
+		void markViewport();
+		void drawViewChanges();
+		bool scrollToCursor();
+		void printMinimap();
+		char minimapGlyph(int, int);
 };
 
 #endif
@@ -0,0 +1,278 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperEventLoop.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperEventLoop class. Waits
+ *	on any number of file descriptors with poll and calls a handler for each
+ *	one that becomes readable. Timers are timerfds on the monotonic clock, so
+ *	they are just another descriptor. Everything runs on the calling thread,
+ *	which keeps all ncurses calls on one thread.
+ *
+ ******************************************************************************/
+#include <stddef.h>		// size_t
+#include <cerrno>
+#include <cstdint>
+#include <sys/timerfd.h>
+#include <unistd.h>		// read, close
+#include "MinesweeperEventLoop.hpp"
+#include "minesweeperTrace.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+*
+* MinesweeperEventLoop::MinesweeperEventLoop()
+*
+* Summary: Constructor
+*
+**/
+MinesweeperEventLoop::MinesweeperEventLoop()
+{
+	running = false;
+}
+
+/**
+*
+* MinesweeperEventLoop::~MinesweeperEventLoop()
+*
+* Summary: Destructor. Closes the loop's timers
+*
+**/
+MinesweeperEventLoop::~MinesweeperEventLoop()
+{
+	for (size_t i = 0; i < sources.size(); i++) {
+		if (sources[i].timer) {
+			close(sources[i].fd);
+		}
+	}
+}
+
+/**
+*
+* bool MinesweeperEventLoop::addReader(int fd, Handler handler)
+*
+* Summary: Calls a handler whenever a file descriptor has input
+*
+* Parameters:	int for the file descriptor, which the caller still owns
+*				Handler to call, it must read the input or it will be
+*				called again straight away
+*
+* Returns:	    bool - false if the descriptor is already watched
+*
+**/
+bool MinesweeperEventLoop::addReader(int fd, Handler handler)
+{
+	if (findSource(fd) >= 0) {
+		return false;
+	}
+
+	Source source = {fd, false, handler};
+	sources.push_back(source);
+	return true;
+}
+
+/**
+*
+* int MinesweeperEventLoop::addTimer(Clock::time_point first,
+*		std::chrono::nanoseconds interval, Handler handler)
+*
+* Summary: Calls a handler at a time and then at a fixed interval
+*
+* Parameters:	time_point on the steady clock for the first call
+*				nanoseconds between calls, 0 for a single call
+*				Handler to call
+*
+* Returns:	    int for the timer, to pass to removeSource, or -1 on error
+*
+* Description: Ticks are counted from the first call, not from when the
+*	handler finished, so a slow handler doesn't make the timer drift. If
+*	ticks are missed while other handlers run, the handler is called once.
+*
+**/
+int MinesweeperEventLoop::addTimer(Clock::time_point first,
+		std::chrono::nanoseconds interval, Handler handler)
+{
+	int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if (fd < 0) {
+		return -1;
+	}
+
+	// timerfd needs a non-zero delay or it is disarmed
+	std::chrono::nanoseconds delay = first - Clock::now();
+	if (delay.count() <= 0) {
+		delay = std::chrono::nanoseconds(1);
+	}
+
+	struct itimerspec spec;
+	spec.it_value.tv_sec = delay.count() / 1000000000;
+	spec.it_value.tv_nsec = delay.count() % 1000000000;
+	spec.it_interval.tv_sec = interval.count() / 1000000000;
+	spec.it_interval.tv_nsec = interval.count() % 1000000000;
+
+	if (timerfd_settime(fd, 0, &spec, nullptr) < 0) {
+		close(fd);
+		return -1;
+	}
+
+	Source source = {fd, true, handler};
+	sources.push_back(source);
+	return fd;
+}
+
+/**
+*
+* void MinesweeperEventLoop::removeSource(int fd)
+*
+* Summary: Stops watching a reader or cancels a timer
+*
+* Parameters:	int for the file descriptor or timer
+*
+* Returns:	    void
+*
+* Description: Safe to call from a handler, including the source's own.
+*
+**/
+void MinesweeperEventLoop::removeSource(int fd)
+{
+	int slot = findSource(fd);
+	if (slot < 0) {
+		return;
+	}
+
+	if (sources[slot].timer) {
+		close(sources[slot].fd);
+	}
+	sources.erase(sources.begin() + slot);
+}
+
+/**
+*
+* void MinesweeperEventLoop::run()
+*
+* Summary: Handles events until stop is called or no readers are left
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+* Description: Each pass polls every source and then calls the handlers of
+*	the ready ones in the order they were added. Handlers may add and remove
+*	sources, so each ready source is looked up again before it is called.
+*
+*	A reader that is closed or fails (e.g. the terminal hangs up) is removed
+*	without calling its handler. Timers alone don't keep the loop running.
+*
+**/
+void MinesweeperEventLoop::run()
+{
+	running = true;
+
+	while (running && hasReaders()) {
+		pollFds.resize(sources.size());
+		for (size_t i = 0; i < sources.size(); i++) {
+			pollFds[i].fd = sources[i].fd;
+			pollFds[i].events = POLLIN;
+			pollFds[i].revents = 0;
+		}
+
+		int ready;
+		{
+			TRACE_SPAN("input", "wait for input");
+			ready = poll(pollFds.data(), pollFds.size(), -1);
+		}
+		if (ready < 0) {
+			if (errno == EINTR) {
+				continue;	// interrupted by a signal such as a resize
+			}
+			break;
+		}
+
+		for (size_t i = 0; i < pollFds.size() && running; i++) {
+			short revents = pollFds[i].revents;
+			if (revents == 0) {
+				continue;
+			}
+
+			int slot = findSource(pollFds[i].fd);
+			if (slot < 0) {
+				continue;	// removed by an earlier handler
+			}
+			if (!(revents & POLLIN)) {
+				removeSource(pollFds[i].fd);	// closed or failed
+				continue;
+			}
+			if (sources[slot].timer) {
+				uint64_t expirations;
+				if (read(sources[slot].fd, &expirations,
+						sizeof(expirations)) < 0) {
+					continue;	// already read, nothing to do
+				}
+			}
+
+			// copy it, the handler may remove its own source
+			Handler handler = sources[slot].handler;
+			handler();
+		}
+	}
+	running = false;
+}
+
+/**
+*
+* void MinesweeperEventLoop::stop()
+*
+* Summary: Makes run return once the current handler finishes
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+**/
+void MinesweeperEventLoop::stop()
+{
+	running = false;
+}
+
+/**
+*
+* bool MinesweeperEventLoop::hasReaders()
+*
+* Summary: Checks if any source other than a timer is watched
+*
+* Parameters:	none
+*
+* Returns:	    bool
+*
+**/
+bool MinesweeperEventLoop::hasReaders()
+{
+	for (size_t i = 0; i < sources.size(); i++) {
+		if (!sources[i].timer) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+*
+* int MinesweeperEventLoop::findSource(int fd)
+*
+* Summary: Finds a source by its file descriptor
+*
+* Parameters:	int for the file descriptor
+*
+* Returns:	    int for its position in sources, or -1
+*
+**/
+int MinesweeperEventLoop::findSource(int fd)
+{
+	for (size_t i = 0; i < sources.size(); i++) {
+		if (sources[i].fd == fd) {
+			return i;
+		}
+	}
+	return -1;
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* File:		MinesweeperEventLoop.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_EVENT_LOOP_HPP
+#define MINESWEEPER_EVENT_LOOP_HPP
+
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <poll.h>
+
+class MinesweeperEventLoop
+{
+	public:
+		typedef std::function<void()> Handler;
+
+		MinesweeperEventLoop();
+		~MinesweeperEventLoop();
+
+		// event sources
+		bool addReader(int, Handler);
+		int addTimer(std::chrono::steady_clock::time_point,
+				std::chrono::nanoseconds, Handler);
+		void removeSource(int);
+
+		// loop control
+		void run();
+		void stop();
+
+	private:
+		struct Source
+		{
+			int fd;
+			bool timer;		// fd is a timerfd owned by the loop
+			Handler handler;
+		};
+
+		bool running;
+		std::vector<Source> sources;
+		std::vector<struct pollfd> pollFds;
+
+		// helper functions
+		int findSource(int);
+		bool hasReaders();
+};
+
+#endif
@@ -9,13 +9,24 @@
  *	manage the game and a MinesweeperDisplay object to display the game.
  * 
  ******************************************************************************/
+#include <cstdio>		// snprintf
 #include <vector>
 #include <ncurses.h>
-#include <thread>
-#include <unistd.h>		// sleep
+#include <unistd.h>		// STDIN_FILENO
 #include "MinesweeperGame.hpp"
+#include "MinesweeperSnapshot.hpp"
+#include "minesweeperStats.hpp"
+#include "minesweeperTrace.hpp"
+#include "minesweeperUtils.hpp"
 
 using std::vector;
+using std::pair;
+
+typedef std::chrono::steady_clock Clock;
+
+static const char *SAVE_FILE = "minesweeper.save";
+static const char *MOVE_LOG_FILE = "minesweeper.moves";
+static const char *STATS_FILE = "minesweeper.stats.json";
 
 /**
 * 
@@ -26,14 +37,80 @@ using std::vector;
 * Parameters:	int for board rows
 *				int for board cols
 *				int for number of mines
+*
+* Description: Every move of the game is recorded to minesweeper.moves, so
+*	it can be replayed later.
 * 
 **/
 MinesweeperGame::MinesweeperGame(int rows, int cols, int mines) 
 {
-	srand(time(0));	// seed for random number generation
-	setGameState(PENDING);
-	gameBoard = new MinesweeperBoard(rows, cols, mines);
+	gameState = PENDING;
+	startTime = endTime = Clock::now();
+	gameBoard = new MinesweeperBoard(rows, cols, mines, randomSeed());
+	gameSolver = new MinesweeperSolver(gameBoard);
 	gameDisplay = new MinesweeperDisplay(rows, cols);
+	eventLoop = new MinesweeperEventLoop();
+	moveLog = new MinesweeperMoveLog();
+	moveLog->create(MOVE_LOG_FILE, rows, cols, mines, 
+			gameBoard->getSafeOpening(), gameBoard->getSeed());
+	replay = nullptr;
+	replayTimer = -1;
+	replaySpeed = 1;
+}
+
+/**
+* 
+* MinesweeperGame::MinesweeperGame(MinesweeperBoard *board) 
+* 
+* Summary: Constructor. Continues a saved game
+*
+* Parameters:	MinesweeperBoard that MinesweeperBoard::restore succeeded 
+*				on, the game takes it over and deletes it
+*
+* Description: Continued games are not recorded, since a move log can only 
+*	replay a game from its first move.
+* 
+**/
+MinesweeperGame::MinesweeperGame(MinesweeperBoard *board) 
+{
+	gameState = PENDING;
+	startTime = endTime = Clock::now();
+	gameBoard = board;
+	gameSolver = new MinesweeperSolver(gameBoard);
+	gameDisplay = new MinesweeperDisplay(gameBoard->getRows(), 
+			gameBoard->getCols());
+	eventLoop = new MinesweeperEventLoop();
+	moveLog = nullptr;
+	replay = nullptr;
+	replayTimer = -1;
+	replaySpeed = 1;
+}
+
+/**
+* 
+* MinesweeperGame::MinesweeperGame(const MinesweeperMoveLog &log) 
+* 
+* Summary: Constructor. Sets up a replay of a recorded game
+*
+* Parameters:	MinesweeperMoveLog that is open for reading, it must outlive
+*				the game
+*
+* Description: Call replayGame instead of startGame.
+* 
+**/
+MinesweeperGame::MinesweeperGame(const MinesweeperMoveLog &log) 
+{
+	gameState = PENDING;
+	startTime = endTime = Clock::now();
+	gameBoard = new MinesweeperBoard(log.getRows(), log.getCols(), 0, 
+			log.getSeed());
+	gameSolver = new MinesweeperSolver(gameBoard);
+	gameDisplay = new MinesweeperDisplay(log.getRows(), log.getCols());
+	eventLoop = new MinesweeperEventLoop();
+	moveLog = nullptr;
+	replay = new MinesweeperReplay(&log, gameBoard, gameSolver);
+	replayTimer = -1;
+	replaySpeed = 1;
 }
 
 /**
@@ -45,10 +122,106 @@ MinesweeperGame::MinesweeperGame(int rows, int cols, int mines)
 **/
 MinesweeperGame::~MinesweeperGame() 
 {
+	delete(eventLoop);
+	delete(moveLog);
+	delete(replay);
+	delete(gameSolver);
 	delete(gameBoard); 
 	delete(gameDisplay);
 }
 
+/**
+* 
+* void MinesweeperGame::reset(int rows, int cols, int mines, uint64_t seed) 
+* 
+* Summary: Starts a new game with the same objects
+*
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+*				uint64_t for the seed used to place mines
+* 				
+* Returns:	    void
+*
+* Description: The board, solver and display reuse their buffers, and the 
+*	ncurses windows are kept when the board is shown the same way as 
+*	before, so playing again doesn't rebuild anything. The new game is 
+*	recorded to minesweeper.moves like one from the constructor, even when 
+*	this game was a continued save or a replay.
+* 
+**/
+void MinesweeperGame::reset(int rows, int cols, int mines, uint64_t seed) 
+{
+	resetGame(rows, cols, mines, seed, false);
+}
+
+/**
+* 
+* void MinesweeperGame::resetNoGuess(int rows, int cols, int mines, 
+*		uint64_t seed, int startRow, int startCol) 
+* 
+* Summary: Starts a new game on a board from MinesweeperGenerator
+*
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+*				uint64_t for a board seed from MinesweeperGenerator
+*				int for the generator's start row
+*				int for the generator's start col
+* 				
+* Returns:	    void
+*
+* Description: The board can only be solved without guessing from the 
+*	start cell, so it is revealed for the player. The reveal is recorded 
+*	like a [g] move, so a replay places the same mines, and it can win the
+*	game on its own the same way.
+* 
+**/
+void MinesweeperGame::resetNoGuess(int rows, int cols, int mines, 
+		uint64_t seed, int startRow, int startCol) 
+{
+	resetGame(rows, cols, mines, seed, true);
+	gameDisplay->setCursorPosition(startRow, startCol);
+	recordMove('g');
+	gameBoard->revealCell(startRow, startCol);
+	setGameState(gameBoard->checkGameState());
+}
+
+/**
+* 
+* void MinesweeperGame::resetGame(int rows, int cols, int mines, 
+*		uint64_t seed, bool safeOpening) 
+* 
+* Summary: Resets the board, solver, display and move log for a new game
+*
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+*				uint64_t for the seed used to place mines
+*				bool - true to place mines after the first reveal
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperGame::resetGame(int rows, int cols, int mines, 
+		uint64_t seed, bool safeOpening) 
+{
+	gameState = PENDING;
+	startTime = endTime = Clock::now();
+	gameBoard->setSafeOpening(safeOpening);
+	gameBoard->reset(rows, cols, mines, seed);
+	gameSolver->reset();
+	gameDisplay->reset(rows, cols);
+	delete(replay);
+	replay = nullptr;
+	replayTimer = -1;
+	replaySpeed = 1;
+	if (!moveLog) {
+		moveLog = new MinesweeperMoveLog();
+	}
+	moveLog->create(MOVE_LOG_FILE, rows, cols, mines, safeOpening, seed);
+}
+
 /**
 * 
 * void MinesweeperGame::startGame() 
@@ -59,151 +232,442 @@ MinesweeperGame::~MinesweeperGame()
 * 				
 * Returns:	   	void
 * 
-* Description: Prints the board and flags. Starts the timer in a new thread.
-*	gets user input until the game state changes or user quits. Requests changes 
-*	to the board based on input and modifes display.
+* Description: Prints the board and flags. Runs an event loop that handles 
+*	user input and a once a second timer on this thread until the game state
+*	changes or user quits. Requests changes to the board based on input and 
+*	modifes display.
 *
-* Reference:
-*	using threads in a class: https://stackoverflow.com/questions/17472827/
+*	Everything runs on one thread, so ncurses is only ever called from here.
+*	While a message is waiting for enter, or the solver is running, the 
+*	timer waits too and then catches up to the real time.
+*
+*	A no guess board whose opening already won the game skips the loop.
 * 
 **/
 void MinesweeperGame::startGame() 
 {
-	gameDisplay->printBoard(gameBoard->getPlayerBoard());
+	gameDisplay->printBoard(gameBoard->getView());
 	gameDisplay->printFlags(gameBoard->getFlagsRemaining());
+	gameDisplay->printTime(0);
 
-	// start the timer on a new thread
-	std::thread timeThread(&MinesweeperGame::timeKeeper, this);
-
-	while (getGameState() == PENDING) {
-		int ch = gameDisplay->getUserInput();
-
-		switch (ch) {
-			case KEY_LEFT:			
-			case 'h':
-				moveCursorOnBoard(0, -1);
-				break;
-			case KEY_RIGHT:		
-			case 'l':
-				moveCursorOnBoard(0, 1);
-				break;
-			case KEY_UP:		
-			case 'k':
-				moveCursorOnBoard(-1, 0);
-				break;
-			case KEY_DOWN:		
-			case 'j':
-				moveCursorOnBoard(1, 0);
-				break;
-			case 'g':		// reveal cell
-				gameBoard->revealCell(gameDisplay->getCursorRow(), 
-						gameDisplay->getCursorCol());
-				setGameState(gameBoard->checkGameState());
-				gameDisplay->printBoard(gameBoard->getPlayerBoard());
-				break;
-			case 'r':		// reveal random cell
-				gameDisplay->printGameMessage("Computer is making a guess");
-				gameBoard->revealRandomCell();
-				setGameState(gameBoard->checkGameState());
-				gameDisplay->printBoard(gameBoard->getPlayerBoard());
-				break;
-			case 'f':		// flag cell
-				gameBoard->flipCellFlag(gameDisplay->getCursorRow(), 
-						gameDisplay->getCursorCol());
-				gameDisplay->printBoard(gameBoard->getPlayerBoard());
-				gameDisplay->printFlags(gameBoard->getFlagsRemaining());
-				break;
-			case 'v':		// verify flags 
-				if (gameBoard->verifyFlags()) {
-					gameDisplay->printGameMessage("Flags are valid");
-				}
-				else {
-					gameDisplay->printGameMessage("Flags are not valid");
+	startTime = Clock::now();
+	if (getGameState() != PENDING) {
+		endTime = startTime;
+	}
+	else {
+		int timer = eventLoop->addTimer(startTime + std::chrono::seconds(1),
+				std::chrono::seconds(1), [this] { printElapsedTime(); });
+		eventLoop->addReader(STDIN_FILENO, [this] { handleInput(); });
+		eventLoop->run();
+		eventLoop->removeSource(STDIN_FILENO);
+		eventLoop->removeSource(timer);
+	}
+
+	if (getGameState() == PENDING) {	// input was closed
+		recordMove('q');
+		setGameState(LOSE);
+	}
+	if (moveLog) {
+		moveLog->append(MinesweeperMoveLog::END_MOVE, getGameState(), 
+				(int32_t)(uint32_t)gameBoard->getPlayerHash(), 
+				(uint32_t)(getGameSeconds() * 1000));
+		moveLog->close();
+	}
+
+	// game completion messages
+	if (getGameState() == WIN) {
+		char message[64];
+		snprintf(message, sizeof(message), "YOU WIN! (%.3f seconds)", 
+				getGameSeconds());
+		gameDisplay->printGameMessage(message);
+	}
+	else if (getGameState() == LOSE) {
+		gameBoard->revealMines();
+		printBoardChanges();
+		gameDisplay->printGameMessage("YOU LOSE :(");
+	}
+
+	// make way for the menu, the windows are kept in case of a reset
+	gameDisplay->clearScreen();
+	writeStats(STATS_FILE);		// only in stats builds
+}
+
+/**
+* 
+* void MinesweeperGame::handleInput()
+* 
+* Summary: Handles every key the user has typed
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Called by the event loop when input arrives. Stops the loop 
+*	once the game is over.
+*
+**/
+void MinesweeperGame::handleInput()
+{
+	int ch;
+
+	while (getGameState() == PENDING 
+			&& (ch = gameDisplay->getPendingInput()) != ERR) {
+		handleKey(ch);
+	}
+	if (getGameState() != PENDING) {
+		eventLoop->stop();
+	}
+}
+
+/**
+* 
+* void MinesweeperGame::handleKey(int ch)
+* 
+* Summary: Carries out a single command from the user
+* 
+* Parameters:	int for the key pressed
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperGame::handleKey(int ch)
+{
+	STATS_TIMER(INPUT_TIMER);
+	STATS_ADD(KEYS_HANDLED, 1);
+	TRACE_SPAN_ARG("input", "key", "key", ch);
+
+	switch (ch) {
+		case KEY_LEFT:			
+		case 'h':
+			moveCursorOnBoard(0, -1);
+			break;
+		case KEY_RIGHT:		
+		case 'l':
+			moveCursorOnBoard(0, 1);
+			break;
+		case KEY_UP:		
+		case 'k':
+			moveCursorOnBoard(-1, 0);
+			break;
+		case KEY_DOWN:		
+		case 'j':
+			moveCursorOnBoard(1, 0);
+			break;
+		case 'g':		// reveal cell
+			recordMove(ch);
+			gameBoard->revealCell(gameDisplay->getCursorRow(), 
+					gameDisplay->getCursorCol());
+			setGameState(gameBoard->checkGameState());
+			printBoardChanges();
+			break;
+		case 'r':		// reveal random cell
+			recordMove(ch);
+			gameDisplay->printGameMessage("Computer is making a guess");
+			gameBoard->revealRandomCell();
+			setGameState(gameBoard->checkGameState());
+			printBoardChanges();
+			break;
+		case 'f':		// flag cell
+			recordMove(ch);
+			gameBoard->flipCellFlag(gameDisplay->getCursorRow(), 
+					gameDisplay->getCursorCol());
+			printBoardChanges();
+			gameDisplay->printFlags(gameBoard->getFlagsRemaining());
+			break;
+		case 'v':		// verify flags 
+			if (gameBoard->verifyFlags()) {
+				gameDisplay->printGameMessage("Flags are valid");
+			}
+			else {
+				gameDisplay->printGameMessage("Flags are not valid");
+			}
+			break;
+		case 'c':		// clear flags
+			recordMove(ch);
+			gameBoard->clearFlags();
+			printBoardChanges();
+			gameDisplay->printFlags(gameBoard->getFlagsRemaining());
+			break;
+		case 's':		// solve puzzle
+			recordMove(ch);
+			gameDisplay->printGameMessage(
+						"Computer will attempt to solve puzzle");
+			gameBoard->clearFlags();
+			while (getGameState() == PENDING) {
+				if (!gameSolver->solvePuzzle()) {
+					gameDisplay->printGameMessage(
+							"Computer is making a guess");
+					gameSolver->makeGuess();
 				}
-				break;
-			case 'c':		// clear flags
-				gameBoard->clearFlags();
-				gameDisplay->printBoard(gameBoard->getPlayerBoard());
+				setGameState(gameBoard->checkGameState());
+				printBoardChanges();
 				gameDisplay->printFlags(gameBoard->getFlagsRemaining());
-				break;
-			case 's':		// solve puzzle
+			}
+			break;
+		case 'w':		// save game
+			if (MinesweeperSnapshot::save(*gameBoard, SAVE_FILE)) {
 				gameDisplay->printGameMessage(
-							"Computer will attempt to solve puzzle");
-				gameBoard->clearFlags();
-				while (getGameState() == PENDING) {
-					if (!gameBoard->solvePuzzle()) {
-						gameDisplay->printGameMessage(
-								"Computer is making a guess");
-						gameBoard->revealRandomCell();
-					}
-					setGameState(gameBoard->checkGameState());
-					gameDisplay->printBoard(gameBoard->getPlayerBoard());
-					gameDisplay->printFlags(gameBoard->getFlagsRemaining());
-				}
-				break;
-			case '?':		// help
-				gameDisplay->printGameMessage(					
-					"[arrow keys] - navigate\n"
-					"[hjkl] - navigate (alternate method using vim keys)\n"
-					"[g] - reveal selected\n"
-					"[r] - reveal random\n"
-					"[f] - flag selected\n"
-					"[v] - verify that flags present valid solution\n"
-					"      does not check correctness\n"
-					"[c] - clear all flags\n"
-					"[s] - solve puzzle\n"
-					"      does not guarantee a winning solution\n"
-					"[?] - help menu\n"
-					"[q] - quit");
-				break;
-			default:
-				break;
-		}
-
-		if (ch == 'q') {	// user has quit game
-			setGameState(LOSE);
+						"Game saved to minesweeper.save");
+			}
+			else {
+				gameDisplay->printGameMessage("Game could not be saved");
+			}
+			break;
+		case '?':		// help
+			gameDisplay->printGameMessage(					
+				"[arrow keys] - navigate\n"
+				"[hjkl] - navigate (alternate method using vim keys)\n"
+				"[g] - reveal selected\n"
+				"[r] - reveal random\n"
+				"[f] - flag selected\n"
+				"[v] - verify that flags present valid solution\n"
+				"      does not check correctness\n"
+				"[c] - clear all flags\n"
+				"[s] - solve puzzle\n"
+				"      does not guarantee a winning solution\n"
+				"[w] - save game, run ./minesweeper minesweeper.save\n"
+				"      to continue it\n"
+				"[?] - help menu\n"
+				"[q] - quit");
+			break;
+		default:
 			break;
-		}
 	}
 
-	// game completion messages
+
+	if (ch == 'q') {	// user has quit game
+		recordMove(ch);
+		setGameState(LOSE);
+	}
+}
+
+/**
+* 
+* void MinesweeperGame::recordMove(int action)
+* 
+* Summary: Appends a move at the cursor to the move log
+* 
+* Parameters:	int for the key of the move
+* 				
+* Returns:	    void
+*
+* Description: Only keys that change the board are recorded, see 
+*	MinesweeperReplay::playMove. Does nothing when the game isn't recorded.
+*
+**/
+void MinesweeperGame::recordMove(int action)
+{
+	if (moveLog) {
+		moveLog->append(action, gameDisplay->getCursorRow(), 
+				gameDisplay->getCursorCol(), 
+				(uint32_t)(getGameSeconds() * 1000));
+	}
+}
+
+/**
+* 
+* void MinesweeperGame::replayGame(double speed) 
+* 
+* Summary: Plays back a recorded game
+* 
+* Parameters:	double for how many times faster than recorded to play
+* 				
+* Returns:	   	void
+* 
+* Description: Each move is played when it was made in the recorded game, 
+*	scaled by speed, and the board is redrawn after it. Runs on the event 
+*	loop like startGame, so q stops the replay at any point. When the 
+*	replay ends, shows the result and whether it matches the recording.
+* 
+**/
+void MinesweeperGame::replayGame(double speed) 
+{
+	replaySpeed = speed;
+	gameDisplay->printBoard(gameBoard->getView());
+	gameDisplay->printFlags(gameBoard->getFlagsRemaining());
+	gameDisplay->printTime(0);
+
+	startTime = Clock::now();
+	if (replay->hasNextMove()) {
+		scheduleReplayMove();
+		eventLoop->addReader(STDIN_FILENO, [this] {
+			int ch;
+			while ((ch = gameDisplay->getPendingInput()) != ERR) {
+				if (ch == 'q') {
+					eventLoop->stop();
+				}
+			}
+		});
+		eventLoop->run();
+		eventLoop->removeSource(STDIN_FILENO);
+		eventLoop->removeSource(replayTimer);
+	}
+	setGameState(replay->getGameState());
+
+	char message[96];
+	const char *result = "UNFINISHED";
 	if (getGameState() == WIN) {
-		gameDisplay->printGameMessage("YOU WIN!");
+		result = "WON";
 	}
 	else if (getGameState() == LOSE) {
+		result = "LOST";
 		gameBoard->revealMines();
-		gameDisplay->printBoard(gameBoard->getPlayerBoard());
-		gameDisplay->printGameMessage("YOU LOSE :(");
+		printBoardChanges();
+	}
+
+	if (replay->getLogEnded()) {
+		snprintf(message, sizeof(message), "REPLAY %s after %lu moves (%s)",
+				result, (unsigned long)replay->getPosition() - 1, 
+				replay->matchesLog() ? "matches the recording" 
+						: "DOES NOT MATCH the recording");
+	}
+	else {
+		snprintf(message, sizeof(message), "REPLAY STOPPED after %lu moves",
+				(unsigned long)replay->getPosition());
 	}
+	gameDisplay->printGameMessage(message);
+}
 
-	timeThread.join();
+/**
+* 
+* void MinesweeperGame::scheduleReplayMove()
+* 
+* Summary: Sets a timer for the next move of a replay
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperGame::scheduleReplayMove()
+{
+	replayTimer = eventLoop->addTimer(getReplayTime(replay->getNextMillis()), 
+			std::chrono::nanoseconds(0), [this] { playReplayMoves(); });
 }
 
 /**
 * 
-* void MinesweeperGame::timeKeeper()
+* void MinesweeperGame::playReplayMoves()
 * 
-* Summary: Tracks the game time and prints to display once per second
+* Summary: Plays every replay move that is due and redraws the board
 * 
 * Parameters:	none
 * 				
 * Returns:	    void
 *
-* Description: Runs continuously in a loop until the game state changes - it
-*	should only be called by a separate thread or process.
+* Description: Called by the replay timer. Moves made close together (or 
+*	a fast replay) are drawn together. Stops the event loop at the end of 
+*	the log.
 *
 **/
-void MinesweeperGame::timeKeeper()
+void MinesweeperGame::playReplayMoves()
 {
-	time_t start, current;
-	double elapsed = 0;
-	time(&start);
-
-	while (getGameState() == PENDING) {
-		elapsed = difftime(time(&current), start);
-		gameDisplay->printTime(elapsed);
-		sleep(1);
-	} 
+	eventLoop->removeSource(replayTimer);
+
+	Clock::time_point now = Clock::now();
+	bool playing = true;
+	while (playing && replay->hasNextMove() 
+			&& getReplayTime(replay->getNextMillis()) <= now) {
+		playing = replay->step();
+	}
+
+	printBoardChanges();
+	gameDisplay->printFlags(gameBoard->getFlagsRemaining());
+	gameDisplay->printTime(replay->getMillis() / 1000);
+
+	if (playing && replay->hasNextMove()) {
+		scheduleReplayMove();
+	}
+	else {
+		eventLoop->stop();
+	}
+}
+
+/**
+* 
+* Clock::time_point MinesweeperGame::getReplayTime(uint32_t millis)
+* 
+* Summary: Returns when a recorded move should be played in the replay
+* 
+* Parameters:	uint32_t for the milliseconds into the recorded game
+* 				
+* Returns:	    time_point on the steady clock
+*
+**/
+Clock::time_point MinesweeperGame::getReplayTime(uint32_t millis)
+{
+	std::chrono::duration<double, std::milli> offset(millis / replaySpeed);
+
+	return startTime + std::chrono::duration_cast<Clock::duration>(offset);
+}
+
+/**
+* 
+* void MinesweeperGame::printElapsedTime()
+* 
+* Summary: Prints the whole seconds played so far
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Called by the event loop once a second, on the second after 
+*	startTime. The time is read from the clock rather than counted, so ticks
+*	missed while a message was showing don't make it fall behind.
+*
+**/
+void MinesweeperGame::printElapsedTime()
+{
+	TRACE_SPAN("timer", "tick");
+	gameDisplay->printTime((int)getGameSeconds());
+}
+
+/**
+* 
+* double MinesweeperGame::getGameSeconds()
+* 
+* Summary: Returns how long the game has been played
+* 
+* Parameters:	none
+* 				
+* Returns:	    double for the time in seconds
+*
+* Description: Measured with the monotonic steady clock, so it has sub-second
+*	resolution and is not affected by changes to the system time. Stops 
+*	counting when the game is won or lost.
+*
+**/
+double MinesweeperGame::getGameSeconds()
+{
+	Clock::time_point end = (gameState == PENDING) ? Clock::now() : endTime;
+
+	return std::chrono::duration<double>(end - startTime).count();
+}
+
+/**
+* 
+* void MinesweeperGame::printBoardChanges()
+* 
+* Summary: Redraws the board cells changed by the last move
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Asks the board which cells changed and sends only those to the
+*	display, instead of copying and redrawing the whole board every move.
+*
+**/
+void MinesweeperGame::printBoardChanges()
+{
+	const vector<pair<int, int>> &cells = gameBoard->getChangedCells();
+	MinesweeperBoardView view = gameBoard->getView();
+
+	for (size_t i = 0; i < cells.size(); i++) {
+		gameDisplay->setBoardCell(cells[i].first, cells[i].second, 
+				view(cells[i].first, cells[i].second));
+	}
+	gameDisplay->printBoardChanges();
 }
 
 /**
@@ -240,14 +704,15 @@ void MinesweeperGame::moveCursorOnBoard(int rowChange, int colChange)
 * 				
 * Returns:	    void
 *
-* Description: This function is used to modify a shared resource between threads
+* Description: Records when the game ends.
 *
 **/
 void MinesweeperGame::setGameState(Status newStatus)
 {
-	gameStateMtx.lock();
+	if (gameState == PENDING && newStatus != PENDING) {
+		endTime = Clock::now();
+	}
 	gameState = newStatus;
-	gameStateMtx.unlock();
 }
 
 /**
@@ -260,14 +725,8 @@ void MinesweeperGame::setGameState(Status newStatus)
 * 				
 * Returns:	    Status for the current game state
 *
-* Description: This function is used to access a shared resource between threads
-*
 **/
 Status MinesweeperGame::getGameState()
 {
-	gameStateMtx.lock();
-	Status currentState = gameState;
-	gameStateMtx.unlock();
-	
-	return currentState;
+	return gameState;
 }
@@ -6,29 +6,52 @@
 #ifndef MINESWEEPER_GAME_HPP
 #define MINESWEEPER_GAME_HPP
 
-#include <ctime>	// time_t
-#include <mutex>
+#include <chrono>
+#include <cstdint>
 #include "MinesweeperBoard.hpp"
 #include "MinesweeperDisplay.hpp"
+#include "MinesweeperEventLoop.hpp"
+#include "MinesweeperMoveLog.hpp"
+#include "MinesweeperReplay.hpp"
+#include "MinesweeperSolver.hpp"
 #include "MinesweeperGameStatus.hpp"
 
 class MinesweeperGame
 {
 	public:
 		MinesweeperGame(int, int, int);
+		MinesweeperGame(MinesweeperBoard *);
+		MinesweeperGame(const MinesweeperMoveLog &);
 		~MinesweeperGame();
 
+		void reset(int, int, int, uint64_t);
+		void resetNoGuess(int, int, int, uint64_t, int, int);
 		void startGame();
+		void replayGame(double);
+		double getGameSeconds();
 
 	private:
 		MinesweeperBoard *gameBoard;
+		MinesweeperSolver *gameSolver;
 		MinesweeperDisplay *gameDisplay;
+		MinesweeperEventLoop *eventLoop;
+		MinesweeperMoveLog *moveLog;	// nullptr when not recording
+		MinesweeperReplay *replay;		// nullptr unless replaying
+		int replayTimer;
+		double replaySpeed;
 		Status gameState;
-		time_t startTime;
-		std::mutex gameStateMtx;
+		std::chrono::steady_clock::time_point startTime, endTime;
 
 		// helper functions
-		void timeKeeper();
+		void resetGame(int, int, int, uint64_t, bool);
+		void handleInput();
+		void handleKey(int);
+		void recordMove(int);
+		void playReplayMoves();
+		void scheduleReplayMove();
+		std::chrono::steady_clock::time_point getReplayTime(uint32_t);
+		void printElapsedTime();
+		void printBoardChanges();
 		void moveCursorOnBoard(int, int);
 		void setGameState(Status);
 		Status getGameState();
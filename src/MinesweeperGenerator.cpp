@@ -0,0 +1,311 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperGenerator.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperGenerator class. Finds
+ *	boards that the solver can finish without a single guess.
+ *
+ *	A board is described by its seed. Mines are placed with a safe opening
+ *	around a fixed start cell in the middle of the board, so the same seed
+ *	always gives the same board once that cell is revealed. Candidate seeds
+ *	are tried on every thread of a worker pool, each with its own board and
+ *	solver (and so its own random number generator), until the solver
+ *	finishes one from the start cell using only certain moves. The pool's
+ *	threads sleep between boards and last as long as the generator, so a
+ *	new board doesn't start any threads.
+ *
+ *	Candidates are numbered and their seeds come from the generator seed and
+ *	the candidate number. The board chosen is always the lowest numbered
+ *	candidate that solves, so the result for a seed is the same no matter
+ *	how many threads ran.
+ *
+ ******************************************************************************/
+#include "MinesweeperGenerator.hpp"
+#include "MinesweeperRandom.hpp"
+#include "minesweeperTrace.hpp"
+
+using std::vector;
+
+/**
+*
+* MinesweeperGenerator::MinesweeperGenerator(int rows, int cols, int mines,
+*		int threads)
+*
+* Summary: Constructor
+*
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines, at most rows * cols - 9 so the
+*				start cell can open
+*				int for the number of worker threads, 0 to use every core
+*
+**/
+MinesweeperGenerator::MinesweeperGenerator(int rows, int cols, int mines,
+		int threads)
+{
+	this->rows = rows;
+	this->cols = cols;
+	this->mines = mines;
+	pool = new MinesweeperWorkerPool(threads);
+	threadCount = pool->getThreadCount();
+	startRow = rows / 2;
+	startCol = cols / 2;
+	baseSeed = 0;
+	nextCandidate.store(0);
+	firstSolved.store(MAX_CANDIDATES);
+	stopping.store(false);
+	candidates = 0;
+	prefetching = false;
+
+	for (int t = 0; t < threadCount; t++) {
+		MinesweeperBoard *board = new MinesweeperBoard(rows, cols, mines, 0);
+		board->setSafeOpening(true);
+		MinesweeperSolver *solver = new MinesweeperSolver(board);
+		solver->setParallel(false);
+		boards.push_back(board);
+		solvers.push_back(solver);
+	}
+}
+
+/**
+*
+* MinesweeperGenerator::~MinesweeperGenerator()
+*
+* Summary: Destructor. Stops a background board and frees memory
+*
+**/
+MinesweeperGenerator::~MinesweeperGenerator()
+{
+	stopping.store(true);
+	delete(pool);		// waits for a background board to give up
+	for (int t = 0; t < threadCount; t++) {
+		delete(solvers[t]);
+		delete(boards[t]);
+	}
+}
+
+/**
+*
+* bool MinesweeperGenerator::generate(uint64_t seed, uint64_t &boardSeed)
+*
+* Summary: Finds a board the solver can finish without guessing
+*
+* Parameters:	uint64_t for the generator seed
+*				uint64_t to store the seed of the board found in
+*
+* Returns:	    bool - false if no board was found within MAX_CANDIDATES
+*
+* Description: Blocks until a board is found. To play it, reset a board
+*	with a safe opening and this seed and reveal the start cell first.
+*
+**/
+bool MinesweeperGenerator::generate(uint64_t seed, uint64_t &boardSeed)
+{
+	TRACE_SPAN("generator", "generate");
+
+	startSearch(seed);
+	pool->wait();
+	return finishSearch(boardSeed);
+}
+
+/**
+*
+* void MinesweeperGenerator::prefetch(uint64_t seed)
+*
+* Summary: Starts generating a board in the background
+*
+* Parameters:	uint64_t for the generator seed
+*
+* Returns:	    void
+*
+* Description: Call takeBoard to get the board. Lets the next game's board
+*	be found on the pool while the current game is being played. A board
+*	that was never taken is waited for and dropped. Don't call generate
+*	until the board has been taken.
+*
+**/
+void MinesweeperGenerator::prefetch(uint64_t seed)
+{
+	if (prefetching) {
+		pool->wait();
+	}
+	startSearch(seed);
+	prefetching = true;
+}
+
+/**
+*
+* bool MinesweeperGenerator::takeBoard(uint64_t &boardSeed)
+*
+* Summary: Returns the board started by prefetch
+*
+* Parameters:	uint64_t to store the seed of the board in
+*
+* Returns:	    bool - false if no board was found, or prefetch wasn't called
+*
+* Description: Waits if the board isn't ready yet.
+*
+**/
+bool MinesweeperGenerator::takeBoard(uint64_t &boardSeed)
+{
+	if (!prefetching) {
+		return false;
+	}
+	pool->wait();
+	prefetching = false;
+	return finishSearch(boardSeed);
+}
+
+/**
+*
+* int MinesweeperGenerator::getStartRow()
+*
+* Summary: Returns the row of the cell every board is solved from
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperGenerator::getStartRow()
+{
+	return startRow;
+}
+
+/**
+*
+* int MinesweeperGenerator::getStartCol()
+*
+* Summary: Returns the col of the cell every board is solved from
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperGenerator::getStartCol()
+{
+	return startCol;
+}
+
+/**
+*
+* long MinesweeperGenerator::getCandidates()
+*
+* Summary: Returns how many candidates it took to find the last board
+*
+* Parameters:	none
+*
+* Returns:	    long - the same for a seed on any number of threads
+*
+**/
+long MinesweeperGenerator::getCandidates()
+{
+	return candidates;
+}
+
+/**
+*
+* void MinesweeperGenerator::startSearch(uint64_t seed)
+*
+* Summary: Wakes every worker to try the candidates for a generator seed
+*
+* Parameters:	uint64_t for the generator seed
+*
+* Returns:	    void
+*
+* Description: Returns without waiting. Wait on the pool before calling
+*	finishSearch.
+*
+**/
+void MinesweeperGenerator::startSearch(uint64_t seed)
+{
+	baseSeed = seed;
+	nextCandidate.store(0);
+	firstSolved.store(MAX_CANDIDATES);
+	pool->start([this](int thread) { worker(thread); });
+}
+
+/**
+*
+* bool MinesweeperGenerator::finishSearch(uint64_t &boardSeed)
+*
+* Summary: Reads the board found by a search the pool has finished
+*
+* Parameters:	uint64_t to store the seed of the board found in
+*
+* Returns:	    bool - false if no board was found within MAX_CANDIDATES
+*
+**/
+bool MinesweeperGenerator::finishSearch(uint64_t &boardSeed)
+{
+	long found = firstSolved.load();
+	if (found >= MAX_CANDIDATES || stopping.load()) {
+		candidates = MAX_CANDIDATES;
+		return false;
+	}
+	candidates = found + 1;
+	boardSeed = MinesweeperRandom::deriveSeed(baseSeed, found);
+	return true;
+}
+
+/**
+*
+* void MinesweeperGenerator::worker(int thread)
+*
+* Summary: Tries candidates until a lower numbered one has solved
+*
+* Parameters:	int for the worker number, which picks its board and solver
+*
+* Returns:	    void
+*
+* Description: Candidates are taken in order, so once a worker takes one
+*	past the lowest solved so far, every candidate below it is already
+*	taken and the worker can stop.
+*
+**/
+void MinesweeperGenerator::worker(int thread)
+{
+	TRACE_SPAN("generator", "search");
+
+	while (!stopping.load()) {
+		long candidate = nextCandidate.fetch_add(1);
+		if (candidate >= firstSolved.load()) {
+			break;
+		}
+		if (solvesWithoutGuessing(thread, 
+				MinesweeperRandom::deriveSeed(baseSeed, candidate))) {
+			long best = firstSolved.load();
+			while (candidate < best
+					&& !firstSolved.compare_exchange_weak(best, candidate)) {
+			}
+		}
+	}
+}
+
+/**
+*
+* bool MinesweeperGenerator::solvesWithoutGuessing(int thread, uint64_t seed)
+*
+* Summary: Plays one candidate board with certain moves only
+*
+* Parameters:	int for the worker number
+*				uint64_t for the board seed
+*
+* Returns:	    bool - true if the solver won from the start cell
+*
+**/
+bool MinesweeperGenerator::solvesWithoutGuessing(int thread, uint64_t seed)
+{
+	MinesweeperBoard *board = boards[thread];
+	MinesweeperSolver *solver = solvers[thread];
+
+	board->reset(rows, cols, mines, seed);
+	solver->reset();
+	board->revealCell(startRow, startCol);
+	while (solver->solvePuzzle()) {
+	}
+	return board->checkGameState() == WIN;
+}
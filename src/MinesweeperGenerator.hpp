@@ -0,0 +1,57 @@
+/*******************************************************************************
+* File:		MinesweeperGenerator.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_GENERATOR_HPP
+#define MINESWEEPER_GENERATOR_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "MinesweeperBoard.hpp"
+#include "MinesweeperSolver.hpp"
+#include "MinesweeperWorkerPool.hpp"
+
+class MinesweeperGenerator
+{
+	public:
+		MinesweeperGenerator(int, int, int, int);
+		~MinesweeperGenerator();
+
+		bool generate(uint64_t, uint64_t &);
+		void prefetch(uint64_t);
+		bool takeBoard(uint64_t &);
+
+		// getters
+		int getStartRow();
+		int getStartCol();
+		long getCandidates();
+
+		static const long MAX_CANDIDATES = 1000000;	// per board
+
+	private:
+		int rows, cols, mines, threadCount;
+		int startRow, startCol;		// cell the boards are solved from
+		MinesweeperWorkerPool *pool;	// kept for the generator's lifetime
+		std::vector<MinesweeperBoard *> boards;		// one per worker
+		std::vector<MinesweeperSolver *> solvers;
+
+		// state shared by the workers during a generate
+		uint64_t baseSeed;
+		std::atomic<long> nextCandidate;
+		std::atomic<long> firstSolved;	// lowest candidate that solved
+		std::atomic<bool> stopping;		// set by the destructor
+		long candidates;				// tried to find the last board
+
+		// background generation
+		bool prefetching;		// a prefetch hasn't been taken yet
+
+		// helper functions
+		void startSearch(uint64_t);
+		bool finishSearch(uint64_t &);
+		void worker(int);
+		bool solvesWithoutGuessing(int, uint64_t);
+};
+
+#endif
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperHistogram.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperHistogram class. Counts
+ *	times in log spaced buckets, so percentiles of any number of games can be
+ *	read from a fixed amount of memory (about 15 KB). Times under 32 ns get
+ *	a bucket each. Above that, every power of two is split into 32 equal
+ *	buckets, and a percentile is read from the middle of its bucket, so it
+ *	is within 1/64 (about 1.6%) of the exact one. Histograms merge by adding
+ *	their counts, which gives the same result in any order.
+ *
+ ******************************************************************************/
+#include "MinesweeperHistogram.hpp"
+
+/**
+*
+* MinesweeperHistogram::MinesweeperHistogram()
+*
+* Summary: Constructor. Starts empty
+*
+**/
+MinesweeperHistogram::MinesweeperHistogram()
+{
+	counts.assign(BUCKET_COUNT, 0);
+	count = 0;
+	maxNanos = 0;
+}
+
+/**
+*
+* MinesweeperHistogram::~MinesweeperHistogram()
+*
+* Summary: Destructor
+*
+**/
+MinesweeperHistogram::~MinesweeperHistogram()
+{
+
+}
+
+/**
+*
+* void MinesweeperHistogram::add(double seconds)
+*
+* Summary: Counts one time
+*
+* Parameters:	double for the time in seconds
+*
+* Returns:	    void
+*
+**/
+void MinesweeperHistogram::add(double seconds)
+{
+	uint64_t nanos = seconds > 0 ? (uint64_t)(seconds * 1e9 + 0.5) : 0;
+
+	counts[bucketIndex(nanos)]++;
+	count++;
+	if (nanos > maxNanos) {
+		maxNanos = nanos;
+	}
+}
+
+/**
+*
+* void MinesweeperHistogram::merge(const MinesweeperHistogram &other)
+*
+* Summary: Adds the times counted by another histogram to this one
+*
+* Parameters:	MinesweeperHistogram to add
+*
+* Returns:	    void
+*
+**/
+void MinesweeperHistogram::merge(const MinesweeperHistogram &other)
+{
+	for (int i = 0; i < BUCKET_COUNT; i++) {
+		counts[i] += other.counts[i];
+	}
+	count += other.count;
+	if (other.maxNanos > maxNanos) {
+		maxNanos = other.maxNanos;
+	}
+}
+
+/**
+*
+* long MinesweeperHistogram::getCount() const
+*
+* Summary: Returns the number of times counted
+*
+* Parameters:	none
+*
+* Returns:	    long
+*
+**/
+long MinesweeperHistogram::getCount() const
+{
+	return count;
+}
+
+/**
+*
+* double MinesweeperHistogram::getPercentile(double fraction) const
+*
+* Summary: Returns a percentile using the nearest rank
+*
+* Parameters:	double for the percentile as a fraction (0.5 for p50)
+*
+* Returns:	    double for the time in seconds, 0 if nothing was counted
+*
+* Description: The time is the middle of the bucket the rank falls in, but
+*	never more than the longest time counted.
+*
+**/
+double MinesweeperHistogram::getPercentile(double fraction) const
+{
+	if (count == 0) {
+		return 0;
+	}
+	long rank = (long)(fraction * count);
+	if (rank >= count) {
+		rank = count - 1;
+	}
+
+	long seen = 0;
+	int bucket = 0;
+	while (seen + counts[bucket] <= rank) {
+		seen += counts[bucket];
+		bucket++;
+	}
+
+	uint64_t nanos = bucketLow(bucket) + bucketWidth(bucket) / 2;
+	if (nanos > maxNanos) {
+		nanos = maxNanos;
+	}
+	return nanos / 1e9;
+}
+
+/**
+*
+* double MinesweeperHistogram::getMax() const
+*
+* Summary: Returns the longest time counted, exactly
+*
+* Parameters:	none
+*
+* Returns:	    double for the time in seconds
+*
+**/
+double MinesweeperHistogram::getMax() const
+{
+	return maxNanos / 1e9;
+}
+
+/**
+*
+* static int MinesweeperHistogram::bucketIndex(uint64_t nanos)
+*
+* Summary: Returns the bucket a time falls in
+*
+* Parameters:	uint64_t for the time in nanoseconds
+*
+* Returns:	    int
+*
+* Description: Past the first SUB_BUCKETS buckets, the group is the position
+*	of the highest set bit and the bucket within it is the SUB_BUCKET_BITS
+*	bits below that.
+*
+**/
+int MinesweeperHistogram::bucketIndex(uint64_t nanos)
+{
+	if (nanos < (uint64_t)SUB_BUCKETS) {
+		return (int)nanos;
+	}
+	int highBit = 63 - __builtin_clzll(nanos);
+	int group = highBit - SUB_BUCKET_BITS + 1;
+	int sub = (int)(nanos >> (highBit - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+	return group * SUB_BUCKETS + sub;
+}
+
+/**
+*
+* static uint64_t MinesweeperHistogram::bucketLow(int bucket)
+*
+* Summary: Returns the shortest time in a bucket
+*
+* Parameters:	int for the bucket
+*
+* Returns:	    uint64_t for the time in nanoseconds
+*
+**/
+uint64_t MinesweeperHistogram::bucketLow(int bucket)
+{
+	int group = bucket / SUB_BUCKETS, sub = bucket % SUB_BUCKETS;
+	if (group == 0) {
+		return sub;
+	}
+	return (uint64_t)(SUB_BUCKETS + sub) << (group - 1);
+}
+
+/**
+*
+* static uint64_t MinesweeperHistogram::bucketWidth(int bucket)
+*
+* Summary: Returns the number of nanoseconds a bucket covers
+*
+* Parameters:	int for the bucket
+*
+* Returns:	    uint64_t
+*
+**/
+uint64_t MinesweeperHistogram::bucketWidth(int bucket)
+{
+	int group = bucket / SUB_BUCKETS;
+	if (group == 0) {
+		return 1;
+	}
+	return (uint64_t)1 << (group - 1);
+}
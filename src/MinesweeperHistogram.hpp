@@ -0,0 +1,43 @@
+/*******************************************************************************
+* File:		MinesweeperHistogram.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_HISTOGRAM_HPP
+#define MINESWEEPER_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <vector>
+
+class MinesweeperHistogram
+{
+	public:
+		MinesweeperHistogram();
+		~MinesweeperHistogram();
+
+		// setters
+		void add(double);
+		void merge(const MinesweeperHistogram &);
+
+		// getters
+		long getCount() const;
+		double getPercentile(double) const;
+		double getMax() const;
+
+	private:
+		// each power of two is split into SUB_BUCKETS buckets
+		static const int SUB_BUCKET_BITS = 5;
+		static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+		static const int BUCKET_COUNT = SUB_BUCKETS * (65 - SUB_BUCKET_BITS);
+
+		std::vector<long> counts;	// by bucket, times in nanoseconds
+		long count;
+		uint64_t maxNanos;
+
+		// helper functions
+		static int bucketIndex(uint64_t);
+		static uint64_t bucketLow(int);
+		static uint64_t bucketWidth(int);
+};
+
+#endif
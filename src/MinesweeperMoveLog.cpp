@@ -0,0 +1,308 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperMoveLog.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperMoveLog class. Records
+ *	every move of a game to a compact binary file as it is made, and opens
+ *	recorded files for MinesweeperReplay. The file starts with the board's
+ *	size and seed, followed by a fixed 16 byte record per move. Records are
+ *	only ever appended and each one is flushed when it is written, so a log
+ *	cut short by a crash still replays up to its last move.
+ *
+ *	Opening a log maps it into memory, so a replay reads the moves in place
+ *	without parsing them. Like snapshots, logs are stored in the host's byte
+ *	order.
+ *
+ ******************************************************************************/
+#include <cstring>		// memcpy, memcmp, memset
+#include <fcntl.h>		// open
+#include <sys/mman.h>	// mmap
+#include <sys/stat.h>	// fstat
+#include <unistd.h>		// close
+#include "MinesweeperMoveLog.hpp"
+
+static const char MOVE_LOG_MAGIC[8] = {'M', 'S', 'W', 'P', 'M', 'O', 'V', 'E'};
+
+/**
+*
+* MinesweeperMoveLog::MinesweeperMoveLog()
+*
+* Summary: Constructor. Call create to record or open to read a log.
+*
+**/
+MinesweeperMoveLog::MinesweeperMoveLog()
+{
+	file = nullptr;
+	mapping = nullptr;
+	mappingSize = 0;
+	header = nullptr;
+	moves = nullptr;
+	moveCount = 0;
+}
+
+/**
+*
+* MinesweeperMoveLog::~MinesweeperMoveLog()
+*
+* Summary: Destructor
+*
+**/
+MinesweeperMoveLog::~MinesweeperMoveLog()
+{
+	close();
+}
+
+/**
+*
+* bool MinesweeperMoveLog::create(const char *path, int rows, int cols,
+*		int mines, bool safeOpening, uint64_t seed)
+*
+* Summary: Starts recording a new game
+*
+* Parameters:	char* for the file path, an existing file is replaced
+*				int for board rows
+*				int for board cols
+*				int for number of mines
+*				bool for whether the board has a safe opening
+*				uint64_t for the seed the board was reset with
+*
+* Returns:	    bool - true if the file was created
+*
+**/
+bool MinesweeperMoveLog::create(const char *path, int rows, int cols,
+		int mines, bool safeOpening, uint64_t seed)
+{
+	close();
+
+	Header out;
+	memset(&out, 0, sizeof(out));
+	memcpy(out.magic, MOVE_LOG_MAGIC, sizeof(out.magic));
+	out.version = VERSION;
+	out.flags = safeOpening ? SAFE_OPENING : 0;
+	out.rows = rows;
+	out.cols = cols;
+	out.mines = mines;
+	out.seed = seed;
+
+	file = fopen(path, "wb");
+	if (!file) {
+		return false;
+	}
+	if (fwrite(&out, sizeof(out), 1, file) != 1 || fflush(file) != 0) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+/**
+*
+* bool MinesweeperMoveLog::append(int action, int row, int col,
+*		uint32_t millis)
+*
+* Summary: Records a move
+*
+* Parameters:	int for the action, the game key (e.g. 'g') or END_MOVE
+*				int for the row
+*				int for the col
+*				uint32_t for the milliseconds since the game started
+*
+* Returns:	    bool - false if the log isn't being recorded or can't be
+*				written
+*
+**/
+bool MinesweeperMoveLog::append(int action, int row, int col, uint32_t millis)
+{
+	if (!file) {
+		return false;
+	}
+
+	Move move;
+	memset(&move, 0, sizeof(move));
+	move.millis = millis;
+	move.row = row;
+	move.col = col;
+	move.action = action;
+	return fwrite(&move, sizeof(move), 1, file) == 1 && fflush(file) == 0;
+}
+
+/**
+*
+* bool MinesweeperMoveLog::open(const char *path)
+*
+* Summary: Maps a recorded log into memory
+*
+* Parameters:	char* for the file path
+*
+* Returns:	    bool - false if the file can't be read, isn't a move log, is
+*				from another version or has an invalid board
+*
+* Description: A partial record at the end (from a crash mid write) is
+*	ignored.
+*
+**/
+bool MinesweeperMoveLog::open(const char *path)
+{
+	close();
+
+	int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) < 0 || (size_t)info.st_size < sizeof(Header)) {
+		::close(fd);
+		return false;
+	}
+
+	mappingSize = info.st_size;
+	mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);	// the mapping stays valid after the file is closed
+	if (mapping == MAP_FAILED) {
+		mapping = nullptr;
+		mappingSize = 0;
+		return false;
+	}
+
+	header = (const Header *)mapping;
+	moves = (const Move *)(header + 1);
+	moveCount = (mappingSize - sizeof(Header)) / sizeof(Move);
+
+	bool valid = memcmp(header->magic, MOVE_LOG_MAGIC, sizeof(header->magic))
+					== 0
+			&& header->version == VERSION
+			&& header->rows > 0 && header->cols > 0 && header->mines >= 0
+			&& (int64_t)header->mines <= (int64_t)header->rows * header->cols
+			&& (int64_t)(header->rows + 2) * (header->cols + 2) <= INT32_MAX;
+	if (!valid) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+/**
+*
+* void MinesweeperMoveLog::close()
+*
+* Summary: Finishes recording or unmaps the open log
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+**/
+void MinesweeperMoveLog::close()
+{
+	if (file) {
+		fclose(file);
+	}
+	if (mapping) {
+		munmap(mapping, mappingSize);
+	}
+	file = nullptr;
+	mapping = nullptr;
+	mappingSize = 0;
+	header = nullptr;
+	moves = nullptr;
+	moveCount = 0;
+}
+
+/**
+*
+* int MinesweeperMoveLog::getRows() const
+*
+* Summary: Returns the board rows of the open log
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperMoveLog::getRows() const
+{
+	return header->rows;
+}
+
+/**
+*
+* int MinesweeperMoveLog::getCols() const
+*
+* Summary: Returns the board cols of the open log
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperMoveLog::getCols() const
+{
+	return header->cols;
+}
+
+/**
+*
+* int MinesweeperMoveLog::getMines() const
+*
+* Summary: Returns the number of mines of the open log
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperMoveLog::getMines() const
+{
+	return header->mines;
+}
+
+/**
+*
+* bool MinesweeperMoveLog::getSafeOpening() const
+*
+* Summary: Returns whether the recorded board had a safe opening
+*
+* Parameters:	none
+*
+* Returns:	    bool
+*
+**/
+bool MinesweeperMoveLog::getSafeOpening() const
+{
+	return header->flags & SAFE_OPENING;
+}
+
+/**
+*
+* uint64_t MinesweeperMoveLog::getSeed() const
+*
+* Summary: Returns the seed the recorded board was reset with
+*
+* Parameters:	none
+*
+* Returns:	    uint64_t
+*
+**/
+uint64_t MinesweeperMoveLog::getSeed() const
+{
+	return header->seed;
+}
+
+/**
+*
+* size_t MinesweeperMoveLog::getMoveCount() const
+*
+* Summary: Returns the number of moves in the open log
+*
+* Parameters:	none
+*
+* Returns:	    size_t
+*
+**/
+size_t MinesweeperMoveLog::getMoveCount() const
+{
+	return moveCount;
+}
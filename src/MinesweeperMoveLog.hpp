@@ -0,0 +1,78 @@
+/*******************************************************************************
+* File:		MinesweeperMoveLog.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_MOVE_LOG_HPP
+#define MINESWEEPER_MOVE_LOG_HPP
+
+#include <stddef.h>		// size_t
+#include <cstdint>
+#include <cstdio>
+
+class MinesweeperMoveLog
+{
+	public:
+		// one move as it is stored in the file
+		struct Move
+		{
+			uint32_t millis;	// since the game started
+			int32_t row, col;	// for an END_MOVE, the Status and the low
+								// bits of the board's player hash
+			uint8_t action;		// the game key, e.g. 'g', or END_MOVE
+			uint8_t reserved[3];
+		};
+
+		static const uint8_t END_MOVE = 'e';
+
+		MinesweeperMoveLog();
+		~MinesweeperMoveLog();
+
+		// writing
+		bool create(const char *, int, int, int, bool, uint64_t);
+		bool append(int, int, int, uint32_t);
+
+		// reading
+		bool open(const char *);
+		void close();
+
+		// getters
+		int getRows() const;
+		int getCols() const;
+		int getMines() const;
+		bool getSafeOpening() const;
+		uint64_t getSeed() const;
+		size_t getMoveCount() const;
+		const Move &getMove(size_t) const;
+
+	private:
+		static const uint32_t VERSION = 1;
+		static const uint32_t SAFE_OPENING = 1;		// header flags
+
+		// file layout: the header, then one Move per action. Every field is
+		// naturally aligned so neither struct has padding.
+		struct Header
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t flags;
+			int32_t rows, cols, mines;
+			uint32_t reserved;
+			uint64_t seed;
+		};
+
+		FILE *file;		// open for writing
+		void *mapping;	// open for reading
+		size_t mappingSize;
+		const Header *header;
+		const Move *moves;
+		size_t moveCount;
+};
+
+inline const MinesweeperMoveLog::Move &MinesweeperMoveLog::getMove(
+		size_t position) const
+{
+	return moves[position];
+}
+
+#endif
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperRandom.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperRandom class. A small
+ *	xoshiro256** random number generator. Each board owns one and seeds it
+ *	explicitly, so a seed always gives the same game and boards on different
+ *	threads never share state.
+ *
+ * Reference:
+ *	xoshiro256**: https://prng.di.unimi.it/
+ *	bounded range: https://arxiv.org/abs/1805.10941
+ *
+ ******************************************************************************/
+#include "MinesweeperRandom.hpp"
+
+/**
+*
+* MinesweeperRandom::MinesweeperRandom()
+*
+* Summary: Constructor. Seeds the generator with 0, call seed before use.
+*
+**/
+MinesweeperRandom::MinesweeperRandom()
+{
+	seed(0);
+}
+
+/**
+*
+* MinesweeperRandom::MinesweeperRandom(uint64_t value)
+*
+* Summary: Constructor
+*
+* Parameters:	uint64_t for the seed
+*
+**/
+MinesweeperRandom::MinesweeperRandom(uint64_t value)
+{
+	seed(value);
+}
+
+/**
+*
+* MinesweeperRandom::~MinesweeperRandom()
+*
+* Summary: Destructor
+*
+**/
+MinesweeperRandom::~MinesweeperRandom()
+{
+
+}
+
+/**
+*
+* void MinesweeperRandom::seed(uint64_t value)
+*
+* Summary: Restarts the generator from a seed
+*
+* Parameters:	uint64_t for the seed
+*
+* Returns:	    void
+*
+* Description: The seed is expanded to the 256 bit state with splitmix64, so
+*	nearby seeds (0, 1, 2...) still give unrelated sequences and the state is
+*	never all zero.
+*
+**/
+void MinesweeperRandom::seed(uint64_t value)
+{
+	for (int i = 0; i < STATE_WORDS; i++) {
+		state[i] = splitMix(value);
+	}
+}
+
+/**
+*
+* void MinesweeperRandom::setState(const uint64_t *source)
+*
+* Summary: Restores the generator to a state saved with getState
+*
+* Parameters:	uint64_t array of STATE_WORDS words
+*
+* Returns:	    void
+*
+**/
+void MinesweeperRandom::setState(const uint64_t *source)
+{
+	for (int i = 0; i < STATE_WORDS; i++) {
+		state[i] = source[i];
+	}
+}
+
+/**
+*
+* void MinesweeperRandom::getState(uint64_t *destination) const
+*
+* Summary: Copies out the generator state
+*
+* Parameters:	uint64_t array of STATE_WORDS words to fill
+*
+* Returns:	    void
+*
+* Description: A generator restored from the state with setState continues
+*	with exactly the same numbers.
+*
+**/
+void MinesweeperRandom::getState(uint64_t *destination) const
+{
+	for (int i = 0; i < STATE_WORDS; i++) {
+		destination[i] = state[i];
+	}
+}
+
+/**
+*
+* int MinesweeperRandom::range(int min, int max)
+*
+* Summary: Generates a random num between min (inclusive) and max (inclusive)
+*
+* Parameters:	an int for min number in range
+* 				an int for max number in range
+*
+* Returns:	    an int
+*
+* Description: Scales a 32 bit random number by the size of the range with a
+*	multiply instead of taking it modulo the size, and redraws the few values
+*	that would make some results more likely than others. A redraw is rare,
+*	so this is usually one multiply and no division.
+*
+**/
+int MinesweeperRandom::range(int min, int max)
+{
+	uint32_t size = (uint32_t)(max - min) + 1;
+	uint64_t product = (next() >> 32) * size;
+	uint32_t low = (uint32_t)product;
+
+	if (low < size) {
+		uint32_t threshold = -size % size;
+		while (low < threshold) {
+			product = (next() >> 32) * size;
+			low = (uint32_t)product;
+		}
+	}
+	return min + (int)(product >> 32);
+}
+
+/**
+*
+* static uint64_t MinesweeperRandom::deriveSeed(uint64_t seed, uint64_t n)
+*
+* Summary: Derives the nth seed of a family, such as the games of a batch
+*
+* Parameters:	uint64_t for the seed of the family
+*				uint64_t for the number of the seed wanted
+*
+* Returns:	    uint64_t - the (n + 1)th number of the splitmix64 sequence 
+*				started at seed
+*
+* Description: Neighboring numbers get unrelated seeds, and any one of them
+*	can be found without working out the ones before it.
+*
+**/
+uint64_t MinesweeperRandom::deriveSeed(uint64_t seed, uint64_t n)
+{
+	uint64_t value = seed + n * 0x9e3779b97f4a7c15ULL;
+	return splitMix(value);
+}
+
+/**
+*
+* static uint64_t MinesweeperRandom::splitMix(uint64_t &value)
+*
+* Summary: Advances a splitmix64 sequence and returns its next number
+*
+* Parameters:	uint64_t (reference) for the sequence position
+*
+* Returns:	    uint64_t
+*
+**/
+uint64_t MinesweeperRandom::splitMix(uint64_t &value)
+{
+	uint64_t z = (value += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
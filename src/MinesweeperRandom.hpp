@@ -0,0 +1,59 @@
+/*******************************************************************************
+* File:		MinesweeperRandom.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_RANDOM_HPP
+#define MINESWEEPER_RANDOM_HPP
+
+#include <cstdint>
+
+class MinesweeperRandom
+{
+	public:
+		MinesweeperRandom();
+		MinesweeperRandom(uint64_t);
+		~MinesweeperRandom();
+
+		// setters
+		void seed(uint64_t);
+		void setState(const uint64_t *);
+
+		// getters
+		uint64_t next();
+		int range(int, int);
+		void getState(uint64_t *) const;
+
+		static uint64_t deriveSeed(uint64_t, uint64_t);
+
+		static const int STATE_WORDS = 4;
+
+	private:
+		uint64_t state[STATE_WORDS];
+
+		// helper functions
+		static uint64_t rotateLeft(uint64_t, int);
+		static uint64_t splitMix(uint64_t &);
+};
+
+inline uint64_t MinesweeperRandom::rotateLeft(uint64_t x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+inline uint64_t MinesweeperRandom::next()
+{
+	uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+	uint64_t shifted = state[1] << 17;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= shifted;
+	state[3] = rotateLeft(state[3], 45);
+
+	return result;
+}
+
+#endif
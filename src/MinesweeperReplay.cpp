@@ -0,0 +1,275 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperReplay.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperReplay class. Plays the
+ *	moves of a MinesweeperMoveLog back on a board. The board is reset from the
+ *	seed in the log, and every move makes the same board and solver calls
+ *	that MinesweeperGame::handleKey made when it was recorded, so random
+ *	reveals and solver guesses draw the same numbers and the replay ends on
+ *	exactly the recorded board. The log's last record holds the game result
+ *	and a hash of the final board, which the replay checks against its own.
+ *
+ *	Moves are played as fast as step is called. Pacing them in real time is
+ *	up to the caller, see MinesweeperGame::replayGame.
+ *
+ ******************************************************************************/
+#include "MinesweeperReplay.hpp"
+
+/**
+*
+* MinesweeperReplay::MinesweeperReplay(const MinesweeperMoveLog *log,
+*		MinesweeperBoard *board, MinesweeperSolver *solver)
+*
+* Summary: Constructor. Resets the board and solver to the start of the log.
+*
+* Parameters:	MinesweeperMoveLog that is open for reading
+*				MinesweeperBoard to play the moves on, of any size
+*				MinesweeperSolver playing that board
+*
+* Description: The log, board and solver must outlive the replay.
+*
+**/
+MinesweeperReplay::MinesweeperReplay(const MinesweeperMoveLog *log,
+		MinesweeperBoard *board, MinesweeperSolver *solver)
+{
+	this->log = log;
+	this->board = board;
+	this->solver = solver;
+	position = 0;
+	millis = 0;
+	gameState = PENDING;
+	logEnded = false;
+	matched = false;
+	failed = false;
+
+	board->setSafeOpening(log->getSafeOpening());
+	board->reset(log->getRows(), log->getCols(), log->getMines(),
+			log->getSeed());
+	solver->reset();
+}
+
+/**
+*
+* MinesweeperReplay::~MinesweeperReplay()
+*
+* Summary: Destructor
+*
+**/
+MinesweeperReplay::~MinesweeperReplay()
+{
+
+}
+
+/**
+*
+* bool MinesweeperReplay::step()
+*
+* Summary: Plays the next move of the log
+*
+* Parameters:	none
+*
+* Returns:	    bool - false once there is nothing left to play
+*
+* Description: Stops at the log's end record, and also when the log has a
+*	move after the game ended or a move that is off the board, which means
+*	the replay has gone differently than the recording (or the log is
+*	damaged).
+*
+**/
+bool MinesweeperReplay::step()
+{
+	if (!hasNextMove()) {
+		return false;
+	}
+
+	const MinesweeperMoveLog::Move &move = log->getMove(position++);
+	millis = move.millis;
+
+	if (move.action == MinesweeperMoveLog::END_MOVE) {
+		logEnded = true;
+		matched = move.row == gameState
+				&& (uint32_t)move.col == (uint32_t)board->getPlayerHash();
+		return false;
+	}
+	if (gameState != PENDING || !playMove(move)) {
+		failed = true;
+		return false;
+	}
+	return true;
+}
+
+/**
+*
+* bool MinesweeperReplay::playMove(const MinesweeperMoveLog::Move &move)
+*
+* Summary: Makes the board and solver calls for one recorded move
+*
+* Parameters:	Move to play
+*
+* Returns:	    bool - false if the move can't be played
+*
+* Description: Must make the same calls as MinesweeperGame::handleKey, or
+*	replays of old logs will no longer match. Cursor moves and keys that
+*	don't change the board aren't recorded.
+*
+**/
+bool MinesweeperReplay::playMove(const MinesweeperMoveLog::Move &move)
+{
+	bool onBoard = board->isInBounds(move.row, move.col);
+
+	switch (move.action) {
+		case 'g':		// reveal cell
+			if (!onBoard) {
+				return false;
+			}
+			board->revealCell(move.row, move.col);
+			gameState = board->checkGameState();
+			break;
+		case 'r':		// reveal random cell
+			board->revealRandomCell();
+			gameState = board->checkGameState();
+			break;
+		case 'f':		// flag cell
+			if (!onBoard) {
+				return false;
+			}
+			board->flipCellFlag(move.row, move.col);
+			break;
+		case 'c':		// clear flags
+			board->clearFlags();
+			break;
+		case 's':		// solve puzzle
+			board->clearFlags();
+			while (gameState == PENDING) {
+				if (!solver->solvePuzzle()) {
+					solver->makeGuess();
+				}
+				gameState = board->checkGameState();
+			}
+			break;
+		case 'q':		// quit
+			gameState = LOSE;
+			break;
+		default:
+			return false;
+	}
+	return true;
+}
+
+/**
+*
+* bool MinesweeperReplay::hasNextMove()
+*
+* Summary: Checks if step has a move left to play
+*
+* Parameters:	none
+*
+* Returns:	    bool
+*
+**/
+bool MinesweeperReplay::hasNextMove()
+{
+	return !logEnded && !failed && position < log->getMoveCount();
+}
+
+/**
+*
+* uint32_t MinesweeperReplay::getNextMillis()
+*
+* Summary: Returns when the next move was made in the recorded game
+*
+* Parameters:	none
+*
+* Returns:	    uint32_t for the milliseconds since the game started. Only
+*				valid if hasNextMove.
+*
+**/
+uint32_t MinesweeperReplay::getNextMillis()
+{
+	return log->getMove(position).millis;
+}
+
+/**
+*
+* uint32_t MinesweeperReplay::getMillis()
+*
+* Summary: Returns when the last move played was made in the recorded game
+*
+* Parameters:	none
+*
+* Returns:	    uint32_t for the milliseconds since the game started
+*
+**/
+uint32_t MinesweeperReplay::getMillis()
+{
+	return millis;
+}
+
+/**
+*
+* size_t MinesweeperReplay::getPosition()
+*
+* Summary: Returns the number of moves played so far
+*
+* Parameters:	none
+*
+* Returns:	    size_t
+*
+**/
+size_t MinesweeperReplay::getPosition()
+{
+	return position;
+}
+
+/**
+*
+* Status MinesweeperReplay::getGameState()
+*
+* Summary: Returns the state of the replayed game
+*
+* Parameters:	none
+*
+* Returns:	    Status
+*
+**/
+Status MinesweeperReplay::getGameState()
+{
+	return gameState;
+}
+
+/**
+*
+* bool MinesweeperReplay::getLogEnded()
+*
+* Summary: Checks if the replay reached the log's end record
+*
+* Parameters:	none
+*
+* Returns:	    bool - false if the log was cut short (e.g. the game
+*				crashed) or the replay stopped early
+*
+**/
+bool MinesweeperReplay::getLogEnded()
+{
+	return logEnded;
+}
+
+/**
+*
+* bool MinesweeperReplay::matchesLog()
+*
+* Summary: Checks if the replay ended exactly as the recorded game did
+*
+* Parameters:	none
+*
+* Returns:	    bool - true if the log's end record was reached and the game
+*				result and final board both match it
+*
+**/
+bool MinesweeperReplay::matchesLog()
+{
+	return logEnded && matched;
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+* File:		MinesweeperReplay.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_REPLAY_HPP
+#define MINESWEEPER_REPLAY_HPP
+
+#include <stddef.h>		// size_t
+#include <cstdint>
+#include "MinesweeperBoard.hpp"
+#include "MinesweeperGameStatus.hpp"
+#include "MinesweeperMoveLog.hpp"
+#include "MinesweeperSolver.hpp"
+
+class MinesweeperReplay
+{
+	public:
+		MinesweeperReplay(const MinesweeperMoveLog *, MinesweeperBoard *,
+				MinesweeperSolver *);
+		~MinesweeperReplay();
+
+		bool step();
+
+		// getters
+		bool hasNextMove();
+		uint32_t getNextMillis();
+		uint32_t getMillis();
+		size_t getPosition();
+		Status getGameState();
+		bool getLogEnded();
+		bool matchesLog();
+
+	private:
+		const MinesweeperMoveLog *log;
+		MinesweeperBoard *board;
+		MinesweeperSolver *solver;
+		size_t position;	// next move to play
+		uint32_t millis;	// time of the last move played
+		Status gameState;
+		bool logEnded;		// reached the log's END_MOVE
+		bool matched;		// the game ended as the log says it did
+		bool failed;		// the log has a move that can't be played
+
+		// helper functions
+		bool playMove(const MinesweeperMoveLog::Move &);
+};
+
+#endif
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * 
+ * File:	MinesweeperSimulator.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ * 
+ * Description: Implementation file for the MinesweeperSimulator class. Plays
+ *	complete games with the built in solver and no display or timer thread, so
+ *	game logic can be run and measured without ncurses. The board and solver 
+ *	are reused from game to game, so playing a game allocates nothing once 
+ *	the buffers have warmed up.
+ * 
+ ******************************************************************************/
+#include <chrono>
+#include "MinesweeperSimulator.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static double secondsSince(Clock::time_point);
+
+/**
+* 
+* MinesweeperSimulator::MinesweeperSimulator(int rows, int cols, int mines) 
+* 
+* Summary: Constructor
+* 
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+* 				
+**/
+MinesweeperSimulator::MinesweeperSimulator(int rows, int cols, int mines) 
+{
+	this->rows = rows;
+	this->cols = cols;
+	this->mines = mines;
+	board = new MinesweeperBoard(rows, cols, mines, 0);
+	solver = new MinesweeperSolver(board);
+}
+
+/**
+* 
+* MinesweeperSimulator::~MinesweeperSimulator() 
+* 
+* Summary: Destructor. Frees dynamically allocated memory 
+* 
+**/
+MinesweeperSimulator::~MinesweeperSimulator() 
+{
+	delete(solver);
+	delete(board);
+}
+
+/**
+* 
+* SimulationResult MinesweeperSimulator::playGame(unsigned long seed)
+* 
+* Summary: Plays one game on a new board until it is won or lost
+* 
+* Parameters:	unsigned long for the board seed
+* 				
+* Returns:	    SimulationResult for the outcome and time spent in each phase
+*
+* Description: Plays the same way as the [s] command in MinesweeperGame: 
+*	makes every certain move the solver can find and guesses the safest cell 
+*	when it can't find one. The same seed always plays the same game.
+*
+**/
+SimulationResult MinesweeperSimulator::playGame(unsigned long seed)
+{
+	SimulationResult result;
+	result.guesses = 0;
+	result.solveSeconds = 0;
+	result.guessSeconds = 0;
+
+	Clock::time_point start = Clock::now();
+	board->reset(rows, cols, mines, seed);
+	solver->reset();
+	result.generateSeconds = secondsSince(start);
+
+	Status state = PENDING;
+	while (state == PENDING) {
+		start = Clock::now();
+		bool moveMade = solver->solvePuzzle();
+		result.solveSeconds += secondsSince(start);
+
+		if (!moveMade) {
+			start = Clock::now();
+			solver->makeGuess();
+			result.guessSeconds += secondsSince(start);
+			result.guesses += 1;
+		}
+		state = board->checkGameState();
+	}
+
+	result.status = state;
+	return result;
+}
+
+/**
+* 
+* void MinesweeperSimulator::setParallel(bool parallel)
+* 
+* Summary: Sets whether the solver may use several threads for one guess
+* 
+* Parameters:	bool - false when many games are running side by side
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperSimulator::setParallel(bool parallel)
+{
+	solver->setParallel(parallel);
+}
+
+/**
+* 
+* void MinesweeperSimulator::setSafeOpening(bool safeOpening)
+* 
+* Summary: Sets whether the first reveal of every game is an opening
+* 
+* Parameters:	bool - true to place mines after the first reveal
+* 				
+* Returns:	    void
+*
+* Description: Mine placement then happens during the solver's first guess, 
+*	so it is counted in guess time instead of generate time.
+*
+**/
+void MinesweeperSimulator::setSafeOpening(bool safeOpening)
+{
+	board->setSafeOpening(safeOpening);
+}
+
+/**
+* 
+* static double secondsSince(Clock::time_point start)
+* 
+* Summary: Returns the time elapsed since a point in time
+* 
+* Parameters:	time_point from the steady clock
+* 				
+* Returns:	    double for the elapsed time in seconds
+*
+**/
+static double secondsSince(Clock::time_point start)
+{
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
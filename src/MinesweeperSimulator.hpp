@@ -0,0 +1,38 @@
+/*******************************************************************************
+* File:		MinesweeperSimulator.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_SIMULATOR_HPP
+#define MINESWEEPER_SIMULATOR_HPP
+
+#include "MinesweeperBoard.hpp"
+#include "MinesweeperGameStatus.hpp"
+#include "MinesweeperSolver.hpp"
+
+struct SimulationResult
+{
+	Status status;
+	int guesses;
+	double generateSeconds;		// board setup (mines and hints)
+	double solveSeconds;		// certain moves found by the solver
+	double guessSeconds;		// probabilistic guesses
+};
+
+class MinesweeperSimulator
+{
+	public:
+		MinesweeperSimulator(int, int, int);
+		~MinesweeperSimulator();
+
+		SimulationResult playGame(unsigned long);
+		void setParallel(bool);
+		void setSafeOpening(bool);
+
+	private:
+		int rows, cols, mines;
+		MinesweeperBoard *board;
+		MinesweeperSolver *solver;
+};
+
+#endif
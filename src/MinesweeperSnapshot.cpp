@@ -0,0 +1,459 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperSnapshot.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperSnapshot class. Saves a
+ *	board to a compact binary file and opens saved files by memory-mapping
+ *	them. The file holds the board's dimensions, seed and generator state
+ *	followed by its mine, revealed and flagged bitboards exactly as they are
+ *	laid out in memory, so nothing has to be parsed to read it back. Opening a
+ *	file only checks the fixed-size header, which takes the same time for any
+ *	board size. The checksum covering the whole file is checked by verify.
+ *
+ *	Words are stored in the host's byte order, so a file can only be opened on
+ *	a machine with the same byte order as the one that saved it.
+ *
+ ******************************************************************************/
+#include <cstddef>		// offsetof
+#include <cstdio>		// fopen, rename
+#include <cstring>		// memcpy, memcmp
+#include <string>
+#include <fcntl.h>		// open
+#include <sys/mman.h>	// mmap
+#include <sys/stat.h>	// fstat
+#include <unistd.h>		// close
+#include "MinesweeperSnapshot.hpp"
+
+static const char SNAPSHOT_MAGIC[8] = {'M', 'S', 'W', 'E', 'E', 'P', 'E', 'R'};
+
+/**
+*
+* MinesweeperSnapshot::MinesweeperSnapshot()
+*
+* Summary: Constructor. Call open to read a file.
+*
+**/
+MinesweeperSnapshot::MinesweeperSnapshot()
+{
+	mapping = nullptr;
+	mappingSize = 0;
+	header = nullptr;
+	words = nullptr;
+}
+
+/**
+*
+* MinesweeperSnapshot::~MinesweeperSnapshot()
+*
+* Summary: Destructor
+*
+**/
+MinesweeperSnapshot::~MinesweeperSnapshot()
+{
+	close();
+}
+
+/**
+*
+* static bool MinesweeperSnapshot::save(const MinesweeperBoard &board,
+*		const char *path)
+*
+* Summary: Saves a board to a file
+*
+* Parameters:	MinesweeperBoard to save
+*				char* for the file path
+*
+* Returns:	    bool - true if the file was written
+*
+* Description: The file is written under a temporary name and renamed over
+*	the path when it is complete, so an existing save is never left half
+*	written.
+*
+**/
+bool MinesweeperSnapshot::save(const MinesweeperBoard &board, const char *path)
+{
+	Header out;
+	memset(&out, 0, sizeof(out));
+	memcpy(out.magic, SNAPSHOT_MAGIC, sizeof(out.magic));
+	out.version = VERSION;
+	out.flags = (board.safeOpening ? SAFE_OPENING : 0)
+			| (board.minesPlaced ? MINES_PLACED : 0);
+	out.rows = board.rows;
+	out.cols = board.cols;
+	out.mines = board.mines;
+	out.wordCount = board.mineBits.getWordCount();
+	out.seed = board.seed;
+	board.random.getState(out.randomState);
+
+	const uint64_t *planes[3] = {board.mineBits.getWords(),
+			board.revealedBits.getWords(), board.flaggedBits.getWords()};
+	out.checksum = checksum(out, planes[0], planes[1], planes[2],
+			out.wordCount);
+
+	std::string tempPath = std::string(path) + ".tmp";
+	FILE *file = fopen(tempPath.c_str(), "wb");
+	if (!file) {
+		return false;
+	}
+
+	bool written = fwrite(&out, sizeof(out), 1, file) == 1;
+	for (int i = 0; i < 3 && written; i++) {
+		written = fwrite(planes[i], sizeof(uint64_t), out.wordCount, file)
+				== out.wordCount;
+	}
+	if (fclose(file) != 0) {
+		written = false;
+	}
+
+	if (!written || rename(tempPath.c_str(), path) != 0) {
+		remove(tempPath.c_str());
+		return false;
+	}
+	return true;
+}
+
+/**
+*
+* bool MinesweeperSnapshot::open(const char *path)
+*
+* Summary: Maps a saved board into memory
+*
+* Parameters:	char* for the file path
+*
+* Returns:	    bool - false if the file can't be read, isn't a snapshot, is
+*				from another version or is the wrong size for its board
+*
+* Description: Pages of the file are only read from disk when they are used,
+*	so opening even a very large board is immediate. The checksum is not
+*	checked here, call verify before trusting the board's contents.
+*
+**/
+bool MinesweeperSnapshot::open(const char *path)
+{
+	close();
+
+	int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) < 0 || (size_t)info.st_size < sizeof(Header)) {
+		::close(fd);
+		return false;
+	}
+
+	mappingSize = info.st_size;
+	mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);	// the mapping stays valid after the file is closed
+	if (mapping == MAP_FAILED) {
+		mapping = nullptr;
+		mappingSize = 0;
+		return false;
+	}
+
+	header = (const Header *)mapping;
+	words = (const uint64_t *)(header + 1);
+
+	// the header must describe a board that fits in the rest of the file
+	bool valid = memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic))
+					== 0
+			&& header->version == VERSION
+			&& header->rows > 0 && header->cols > 0 && header->mines >= 0
+			&& (int64_t)header->mines <= (int64_t)header->rows * header->cols;
+	if (valid) {
+		uint64_t cells = (uint64_t)(header->rows + 2) * (header->cols + 2);
+		valid = cells <= INT32_MAX
+				&& header->wordCount == (cells + 63) / 64
+				&& mappingSize == sizeof(Header)
+						+ 3 * sizeof(uint64_t) * (size_t)header->wordCount;
+	}
+
+	if (!valid) {
+		close();
+		return false;
+	}
+	return true;
+}
+
+/**
+*
+* void MinesweeperSnapshot::close()
+*
+* Summary: Unmaps the open file, if any
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+**/
+void MinesweeperSnapshot::close()
+{
+	if (mapping) {
+		munmap(mapping, mappingSize);
+	}
+	mapping = nullptr;
+	mappingSize = 0;
+	header = nullptr;
+	words = nullptr;
+}
+
+/**
+*
+* bool MinesweeperSnapshot::verify() const
+*
+* Summary: Checks the open file against its checksum
+*
+* Parameters:	none
+*
+* Returns:	    bool - true if the file is open and undamaged
+*
+* Description: Reads every word of the file, so it costs about as much as
+*	copying the board.
+*
+**/
+bool MinesweeperSnapshot::verify() const
+{
+	if (!header) {
+		return false;
+	}
+	return checksum(*header, getMineWords(), getRevealedWords(),
+			getFlaggedWords(), header->wordCount) == header->checksum;
+}
+
+/**
+*
+* static uint64_t MinesweeperSnapshot::checksum(const Header &fields,
+*		const uint64_t *mineWords, const uint64_t *revealedWords,
+*		const uint64_t *flaggedWords, int wordCount)
+*
+* Summary: Computes the checksum of a snapshot
+*
+* Parameters:	Header with the fields to cover, its checksum is ignored
+*				uint64_t array for each of the three bitboards
+*				int for the number of words in each bitboard
+*
+* Returns:	    uint64_t
+*
+**/
+uint64_t MinesweeperSnapshot::checksum(const Header &fields,
+		const uint64_t *mineWords, const uint64_t *revealedWords,
+		const uint64_t *flaggedWords, int wordCount)
+{
+	const size_t headerWords = offsetof(Header, checksum) / sizeof(uint64_t);
+	uint64_t headerCopy[headerWords];
+	memcpy(headerCopy, &fields, sizeof(headerCopy));
+
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	hash = mixWords(hash, headerCopy, headerWords);
+	hash = mixWords(hash, mineWords, wordCount);
+	hash = mixWords(hash, revealedWords, wordCount);
+	hash = mixWords(hash, flaggedWords, wordCount);
+	return hash;
+}
+
+/**
+*
+* static uint64_t MinesweeperSnapshot::mixWords(uint64_t hash,
+*		const uint64_t *source, size_t count)
+*
+* Summary: Adds words to a running checksum
+*
+* Parameters:	uint64_t for the checksum so far
+*				uint64_t array of words to add
+*				size_t for the number of words
+*
+* Returns:	    uint64_t for the new checksum
+*
+* Description: FNV-1a taken a word at a time instead of a byte at a time, so
+*	it keeps up with reading the file.
+*
+**/
+uint64_t MinesweeperSnapshot::mixWords(uint64_t hash, const uint64_t *source,
+		size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		hash = (hash ^ source[i]) * 0x100000001b3ULL;
+		hash ^= hash >> 32;
+	}
+	return hash;
+}
+
+/**
+*
+* int MinesweeperSnapshot::getRows() const
+*
+* Summary: Returns the board rows of the open file
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperSnapshot::getRows() const
+{
+	return header->rows;
+}
+
+/**
+*
+* int MinesweeperSnapshot::getCols() const
+*
+* Summary: Returns the board cols of the open file
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperSnapshot::getCols() const
+{
+	return header->cols;
+}
+
+/**
+*
+* int MinesweeperSnapshot::getMines() const
+*
+* Summary: Returns the number of mines of the open file
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperSnapshot::getMines() const
+{
+	return header->mines;
+}
+
+/**
+*
+* uint64_t MinesweeperSnapshot::getSeed() const
+*
+* Summary: Returns the seed the saved game was started from
+*
+* Parameters:	none
+*
+* Returns:	    uint64_t
+*
+**/
+uint64_t MinesweeperSnapshot::getSeed() const
+{
+	return header->seed;
+}
+
+/**
+*
+* bool MinesweeperSnapshot::getSafeOpening() const
+*
+* Summary: Returns whether the saved board had a safe opening
+*
+* Parameters:	none
+*
+* Returns:	    bool
+*
+**/
+bool MinesweeperSnapshot::getSafeOpening() const
+{
+	return header->flags & SAFE_OPENING;
+}
+
+/**
+*
+* bool MinesweeperSnapshot::getMinesPlaced() const
+*
+* Summary: Returns whether the saved board had placed its mines
+*
+* Parameters:	none
+*
+* Returns:	    bool - false if it was saved before the first reveal of a
+*				safe opening
+*
+**/
+bool MinesweeperSnapshot::getMinesPlaced() const
+{
+	return header->flags & MINES_PLACED;
+}
+
+/**
+*
+* const uint64_t *MinesweeperSnapshot::getRandomState() const
+*
+* Summary: Returns the saved board's generator state
+*
+* Parameters:	none
+*
+* Returns:	    uint64_t array of MinesweeperRandom::STATE_WORDS words
+*
+**/
+const uint64_t *MinesweeperSnapshot::getRandomState() const
+{
+	return header->randomState;
+}
+
+/**
+*
+* int MinesweeperSnapshot::getWordCount() const
+*
+* Summary: Returns the number of words in each saved bitboard
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperSnapshot::getWordCount() const
+{
+	return header->wordCount;
+}
+
+/**
+*
+* const uint64_t *MinesweeperSnapshot::getMineWords() const
+*
+* Summary: Returns the saved mine bitboard
+*
+* Parameters:	none
+*
+* Returns:	    uint64_t array of getWordCount words, mapped from the file
+*
+**/
+const uint64_t *MinesweeperSnapshot::getMineWords() const
+{
+	return words;
+}
+
+/**
+*
+* const uint64_t *MinesweeperSnapshot::getRevealedWords() const
+*
+* Summary: Returns the saved revealed bitboard
+*
+* Parameters:	none
+*
+* Returns:	    uint64_t array of getWordCount words, mapped from the file
+*
+**/
+const uint64_t *MinesweeperSnapshot::getRevealedWords() const
+{
+	return words + header->wordCount;
+}
+
+/**
+*
+* const uint64_t *MinesweeperSnapshot::getFlaggedWords() const
+*
+* Summary: Returns the saved flagged bitboard
+*
+* Parameters:	none
+*
+* Returns:	    uint64_t array of getWordCount words, mapped from the file
+*
+**/
+const uint64_t *MinesweeperSnapshot::getFlaggedWords() const
+{
+	return words + 2 * (size_t)header->wordCount;
+}
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* File:		MinesweeperSnapshot.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_SNAPSHOT_HPP
+#define MINESWEEPER_SNAPSHOT_HPP
+
+#include <stddef.h>		// size_t
+#include <cstdint>
+#include "MinesweeperBoard.hpp"
+
+class MinesweeperSnapshot
+{
+	public:
+		MinesweeperSnapshot();
+		~MinesweeperSnapshot();
+
+		static bool save(const MinesweeperBoard &, const char *);
+		bool open(const char *);
+		void close();
+		bool verify() const;
+
+		// getters
+		int getRows() const;
+		int getCols() const;
+		int getMines() const;
+		uint64_t getSeed() const;
+		bool getSafeOpening() const;
+		bool getMinesPlaced() const;
+		const uint64_t *getRandomState() const;
+		int getWordCount() const;
+		const uint64_t *getMineWords() const;
+		const uint64_t *getRevealedWords() const;
+		const uint64_t *getFlaggedWords() const;
+
+	private:
+		static const uint32_t VERSION = 1;
+		static const uint32_t SAFE_OPENING = 1;		// header flags
+		static const uint32_t MINES_PLACED = 2;
+
+		// file layout: the header, then wordCount words for each of the mine,
+		// revealed and flagged bitboards. Every field is naturally aligned so
+		// the struct has no padding.
+		struct Header
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t flags;
+			int32_t rows, cols, mines;
+			uint32_t wordCount;
+			uint64_t seed;
+			uint64_t randomState[MinesweeperRandom::STATE_WORDS];
+			uint64_t checksum;		// of the header above and the words
+		};
+
+		void *mapping;
+		size_t mappingSize;
+		const Header *header;
+		const uint64_t *words;
+
+		// helper functions
+		static uint64_t checksum(const Header &, const uint64_t *,
+				const uint64_t *, const uint64_t *, int);
+		static uint64_t mixWords(uint64_t, const uint64_t *, size_t);
+};
+
+#endif
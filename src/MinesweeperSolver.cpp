@@ -0,0 +1,997 @@
+/*******************************************************************************
+ * 
+ * File:	MinesweeperSolver.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ * 
+ * Description: Implementation file for the MinesweeperSolver class. Contains
+ *	a constraint propagation solver that plays a MinesweeperBoard. Rather than
+ *	sweeping the whole board, it keeps track of the frontier (revealed hint 
+ *	cells that still have covered neighbors) and a worklist of frontier cells
+ *	whose neighborhood has changed since they were last checked. When no move
+ *	is certain, it can work out the exact chance each covered cell is a mine 
+ *	and guess the safest one.
+ * 
+ ******************************************************************************/
+#include <atomic>
+#include <cmath>		// lgamma, exp
+#include "MinesweeperSolver.hpp"
+#include "minesweeperNeighbors.hpp"
+#include "minesweeperStats.hpp"
+#include "minesweeperTrace.hpp"
+#include "minesweeperUtils.hpp"
+
+using std::vector;
+
+static void addComponent(vector<double> &, MinesweeperComponent &,
+		vector<double> &);
+static double logChoose(int, int);
+
+/**
+* 
+* MinesweeperSolver::MinesweeperSolver(MinesweeperBoard *board) 
+* 
+* Summary: Constructor
+* 
+* Parameters:	MinesweeperBoard pointer for the board to solve. The board 
+*				must outlive the solver.
+* 				
+**/
+MinesweeperSolver::MinesweeperSolver(MinesweeperBoard *board) 
+{
+	this->board = board;
+	parallel = true;
+	pool = nullptr;
+	reset();
+}
+
+/**
+* 
+* MinesweeperSolver::~MinesweeperSolver() 
+* 
+* Summary: Destructor. Stops the worker threads, if any were started
+* 
+**/
+MinesweeperSolver::~MinesweeperSolver() 
+{
+	delete(pool);
+}
+
+/**
+* 
+* void MinesweeperSolver::reset() 
+* 
+* Summary: Forgets everything known about the board
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Call after the board is reset. Buffers from the last game are
+*	reused, so nothing is allocated unless the board grows.
+* 
+**/
+void MinesweeperSolver::reset()
+{
+	int boardSize = board->solutionBoard.size();
+
+	logPosition = 0;
+	knownFlagEdits = board->flagEdits;
+	componentCount = 0;
+	frontierCells.clear();
+	worklist.clear();
+	settledCells.clear();
+	edgeCells.clear();
+	frontierSlot.assign(boardSize, -1);
+	edgeSlot.assign(boardSize, -1);
+	queuedBits.resize(boardSize);
+	setNearbyCellOffsets();
+}
+
+/**
+* 
+* void MinesweeperSolver::setParallel(bool parallel) 
+* 
+* Summary: Sets whether makeGuess may use several threads
+* 
+* Parameters:	bool - false to keep all work on the calling thread
+* 				
+* Returns:	    void
+*
+* Description: Turn off when many games are already running side by side.
+* 
+**/
+void MinesweeperSolver::setParallel(bool parallel)
+{
+	this->parallel = parallel;
+}
+
+/**
+* 
+* void MinesweeperSolver::setNearbyCellOffsets() 
+* 
+* Summary: Initializes offsets to every cell within two rows and cols
+* 
+* Parameters:	none (uses member variables)
+* 				
+* Returns:	    void
+*
+* Description: Two hint cells can only share a covered neighbor if they are 
+*	within two cells of each other, so these are the only cells that need to 
+*	be compared by the pair rules. Offsets that step off the side of the board 
+*	wrap around onto the border of the padded board, which is never part of
+*	the frontier.
+* 
+**/
+void MinesweeperSolver::setNearbyCellOffsets()
+{
+	int stride = board->stride;
+	int k = 0;
+
+	for (int i = -2; i <= 2; i++) {
+		for (int j = -2; j <= 2; j++) {
+			if (i != 0 || j != 0) {
+				nearbyCellOffsets[k++] = i * stride + j;
+			}
+		}
+	}
+}
+
+/**
+* 
+* bool MinesweeperSolver::solvePuzzle()
+* 
+* Summary: Attempts to make moves that are sure to be correct
+* 
+* Parameters:	none
+* 				
+* Returns:	    bool - true if it made a move, false if it can't find one
+*
+* Description: First picks up any cells revealed on the board since the last
+*	call. Then works through the worklist applying the single cell rules:
+*
+*	- if hint - flags == covered neighbors, all covered neighbors are mines
+*	- if hint == flags, all covered neighbors are safe
+*
+*	If that finds nothing, compares overlapping pairs of frontier cells for
+*	a multi-cell solution. Work done scales with the frontier rather than the
+*	size of the board.
+*
+*	Clear all flags prior to calling unless certain that flags are correct.
+*
+*	It may take multiple calls to completely solve the puzzle
+*
+**/
+bool MinesweeperSolver::solvePuzzle()
+{
+	STATS_TIMER(SOLVE_TIMER);
+	STATS_ADD(SOLVE_PASSES, 1);
+	TRACE_SPAN("solver", "solve pass");
+
+	syncBoard();
+
+	switch (board->stride) {
+		case BEGINNER_STRIDE:
+			return applyRules<BEGINNER_STRIDE>();
+		case INTERMEDIATE_STRIDE:
+			return applyRules<INTERMEDIATE_STRIDE>();
+		case EXPERT_STRIDE:
+			return applyRules<EXPERT_STRIDE>();
+		default:
+			return applyRules<0>();
+	}
+}
+
+/**
+* 
+* template <int STRIDE> bool MinesweeperSolver::applyRules()
+* 
+* Summary: Applies the single cell rules, then the pair rules
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+* 				
+* Returns:	    bool - true if it made a move
+*
+* Description: Compiled once per preset board width by solvePuzzle, so the 
+*	neighbor loops in the rules use constant offsets (see 
+*	minesweeperNeighbors.hpp).
+*
+**/
+template <int STRIDE>
+bool MinesweeperSolver::applyRules()
+{
+	if (applySingleCellRules<STRIDE>()) {
+		return true;
+	}
+	return applyPairRules<STRIDE>();
+}
+
+/**
+* 
+* int MinesweeperSolver::getFrontierSize()
+* 
+* Summary: Returns the number of cells on the frontier
+* 
+* Parameters:	none
+* 				
+* Returns:	    int
+*
+**/
+int MinesweeperSolver::getFrontierSize()
+{
+	syncBoard();
+	return frontierCells.size();
+}
+
+/**
+* 
+* void MinesweeperSolver::syncBoard()
+* 
+* Summary: Catches the solver up with changes made to the board
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Reads cells added to the board revealLog since the last call.
+*	New hint cells join the frontier, and frontier cells next to any newly
+*	revealed cell are queued since they have one less covered neighbor. If
+*	flags were changed by someone other than the solver the whole frontier is
+*	queued to be checked again, along with the settled cells (hints that left
+*	the frontier with only flags covered around them), since a flag they 
+*	relied on may be gone.
+*
+**/
+void MinesweeperSolver::syncBoard()
+{
+	if (board->flagEdits != knownFlagEdits) {
+		knownFlagEdits = board->flagEdits;
+		for (size_t i = 0; i < settledCells.size(); i++) {
+			addFrontierCell(settledCells[i]);
+		}
+		settledCells.clear();
+		for (size_t i = 0; i < frontierCells.size(); i++) {
+			queueCell(frontierCells[i]);
+		}
+	}
+
+	while (logPosition < board->revealLog.size()) {
+		int idx = board->revealLog[logPosition++];
+
+		if (getHint(idx) > 0) {
+			addFrontierCell(idx);
+		}
+		queueNeighbors(idx);
+	}
+}
+
+/**
+* 
+* void MinesweeperSolver::queueCell(int idx)
+* 
+* Summary: Adds a frontier cell to the worklist if it is not already on it
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperSolver::queueCell(int idx)
+{
+	if (frontierSlot[idx] >= 0 && !queuedBits.test(idx)) {
+		queuedBits.set(idx);
+		worklist.push_back(idx);
+	}
+}
+
+/**
+* 
+* void MinesweeperSolver::queueNeighbors(int idx)
+* 
+* Summary: Adds all frontier neighbors of a cell to the worklist
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperSolver::queueNeighbors(int idx)
+{
+	for (int k = 0; k < MAX_NEIGHBORS; k++) {
+		queueCell(idx + board->neighborCellOffsets[k]);
+	}
+}
+
+/**
+* 
+* void MinesweeperSolver::addFrontierCell(int idx)
+* 
+* Summary: Adds a cell to the frontier and queues it
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    void
+*
+**/
+void MinesweeperSolver::addFrontierCell(int idx)
+{
+	if (frontierSlot[idx] < 0) {
+		frontierSlot[idx] = frontierCells.size();
+		frontierCells.push_back(idx);
+	}
+	queueCell(idx);
+}
+
+/**
+* 
+* void MinesweeperSolver::removeFrontierCell(int idx)
+* 
+* Summary: Removes a cell from the frontier
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    void
+*
+* Description: Moves the last frontier cell into the removed cell's slot so 
+*	removal takes constant time.
+*
+**/
+void MinesweeperSolver::removeFrontierCell(int idx)
+{
+	int slot = frontierSlot[idx];
+
+	if (slot >= 0) {
+		int last = frontierCells.back();
+		frontierCells[slot] = last;
+		frontierSlot[last] = slot;
+		frontierCells.pop_back();
+		frontierSlot[idx] = -1;
+	}
+}
+
+/**
+* 
+* int MinesweeperSolver::getHint(int idx)
+* 
+* Summary: Returns the hint shown in a cell
+* 
+* Parameters:	int for the padded board index of the cell
+* 				
+* Returns:	    int - 1 to 8 for a revealed hint cell, 0 for anything else
+*
+**/
+int MinesweeperSolver::getHint(int idx)
+{
+	char cell = board->solutionBoard[idx];
+
+	if (board->revealedBits.test(idx) && cell > '0' && cell < '9') {
+		return cell - 48;
+	}
+	return 0;
+}
+
+/**
+* 
+* template <int STRIDE> int MinesweeperSolver::getUnknownNeighbors(int idx, 
+*		int *cells)
+* 
+* Summary: Finds the neighbors of a cell that are covered and not flagged
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+*				int for the padded board index of the cell
+*				int array with room for 8 cells to store the neighbors in
+* 				
+* Returns:	    int for the number of neighbors found
+*
+* Description: Every neighbor is written to cells and the count only moves 
+*	past the ones that are unknown, so there is no branch per neighbor.
+*
+**/
+template <int STRIDE>
+int MinesweeperSolver::getUnknownNeighbors(int idx, int *cells)
+{
+	int count = 0;
+
+	forEachNeighbor<STRIDE>(idx, board->stride, [&](int neighbor) {
+		cells[count] = neighbor;
+		count += !board->revealedBits.test(neighbor) 
+				& !board->flaggedBits.test(neighbor);
+	});
+	return count;
+}
+
+/**
+* 
+* template <int STRIDE> int MinesweeperSolver::getFlaggedNeighbors(int idx)
+* 
+* Summary: Counts the flagged neighbors of a cell
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+*				int for the padded board index of the cell
+* 				
+* Returns:	    int
+*
+**/
+template <int STRIDE>
+int MinesweeperSolver::getFlaggedNeighbors(int idx)
+{
+	int count = 0;
+
+	forEachNeighbor<STRIDE>(idx, board->stride, [&](int neighbor) {
+		count += board->flaggedBits.test(neighbor);
+	});
+	return count;
+}
+
+/**
+* 
+* bool MinesweeperSolver::flagCells(const int *cells, int count)
+* 
+* Summary: Flags a list of cells and queues their neighbors
+* 
+* Parameters:	int array of padded board indexes
+*				int for the number of cells in the array
+* 				
+* Returns:	    bool - true if any cell was flagged
+*
+**/
+bool MinesweeperSolver::flagCells(const int *cells, int count)
+{
+	bool moveMade = false;
+
+	for (int i = 0; i < count; i++) {
+		if (board->flagIndex(cells[i])) {
+			queueNeighbors(cells[i]);
+			moveMade = true;
+			STATS_ADD(SOLVER_MOVES, 1);
+		}
+	}
+	knownFlagEdits = board->flagEdits;
+	return moveMade;
+}
+
+/**
+* 
+* bool MinesweeperSolver::revealCells(const int *cells, int count)
+* 
+* Summary: Reveals a list of cells and updates the frontier
+* 
+* Parameters:	int array of padded board indexes
+*				int for the number of cells in the array
+* 				
+* Returns:	    bool - true if any cell was revealed
+*
+**/
+bool MinesweeperSolver::revealCells(const int *cells, int count)
+{
+	bool moveMade = false;
+
+	for (int i = 0; i < count; i++) {
+		if (!board->revealedBits.test(cells[i]) 
+				&& !board->flaggedBits.test(cells[i])) {
+			board->revealIndex(cells[i]);
+			moveMade = true;
+			STATS_ADD(SOLVER_MOVES, 1);
+		}
+	}
+	syncBoard();
+	return moveMade;
+}
+
+/**
+* 
+* template <int STRIDE> bool MinesweeperSolver::applySingleCellRules()
+* 
+* Summary: Applies the single cell rules to every cell on the worklist
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+* 				
+* Returns:	    bool - true if any move was made
+*
+* Description: Moves queue more cells, so this runs until the worklist is 
+*	empty. Cells with no covered neighbors left are removed from the frontier.
+*	Those next to flags are kept as settled cells in case the flags change.
+*	Stops early if a mine is hit (only possible with incorrect flags).
+*
+**/
+template <int STRIDE>
+bool MinesweeperSolver::applySingleCellRules()
+{
+	bool moveMade = false;
+	int unknown[MAX_NEIGHBORS];
+
+	while (!worklist.empty() && !board->mineHit) {
+		int idx = worklist.back();
+		worklist.pop_back();
+		queuedBits.reset(idx);
+
+		int unknownCount = getUnknownNeighbors<STRIDE>(idx, unknown);
+		int flaggedCount = getFlaggedNeighbors<STRIDE>(idx);
+		if (unknownCount == 0) {
+			removeFrontierCell(idx);
+			if (flaggedCount > 0) {
+				settledCells.push_back(idx);
+			}
+			continue;
+		}
+
+		int minesLeft = getHint(idx) - flaggedCount;
+		if (minesLeft == unknownCount) {
+			// every covered neighbor is a mine
+			moveMade |= flagCells(unknown, unknownCount);
+			STATS_ADD(SINGLE_RULE_HITS, 1);
+		}
+		else if (minesLeft == 0) {
+			// every covered neighbor is safe
+			moveMade |= revealCells(unknown, unknownCount);
+			STATS_ADD(SINGLE_RULE_HITS, 1);
+		}
+	}
+	return moveMade;
+}
+
+/**
+* 
+* template <int STRIDE> bool MinesweeperSolver::applyPairRules()
+* 
+* Summary: Compares pairs of nearby frontier cells for a multi-cell solution
+* 
+* Parameters:	STRIDE - the board's stride, or 0 to read it at run time
+* 				
+* Returns:	    bool - true if a move was made
+*
+* Description: For frontier cells A and B that share covered neighbors, let
+*	onlyA and onlyB be the covered neighbors that belong to just one of them.
+*	The shared cells can hold at most A's remaining mines, so:
+*
+*	- if B's remaining - A's remaining == size of onlyB, every cell in onlyB 
+*	  is a mine and every cell in onlyA is safe
+*	- if onlyA is empty and both have the same remaining mines, every cell 
+*	  in onlyB is safe
+*
+*	1 2 1		The 1s share both covered cells under the 2 with it, so the
+*	- - -		cell under each 1 that the 2 can't see is safe.
+*
+*	Applies the first solution found and returns, since the move changes the 
+*	frontier. The worklist picks up from there on the next call.
+*
+**/
+template <int STRIDE>
+bool MinesweeperSolver::applyPairRules()
+{
+	int boardSize = frontierSlot.size();
+	int unknownA[MAX_NEIGHBORS], unknownB[MAX_NEIGHBORS];
+	int onlyA[MAX_NEIGHBORS], onlyB[MAX_NEIGHBORS];
+
+	for (size_t i = 0; i < frontierCells.size() && !board->mineHit; i++) {
+		int a = frontierCells[i];
+		int countA = getUnknownNeighbors<STRIDE>(a, unknownA);
+		int minesA = getHint(a) - getFlaggedNeighbors<STRIDE>(a);
+
+		for (int k = 0; k < NEARBY_COUNT; k++) {
+			int b = a + nearbyCellOffsets[k];
+			if (b < 0 || b >= boardSize || frontierSlot[b] < 0) {
+				continue;
+			}
+
+			int countB = getUnknownNeighbors<STRIDE>(b, unknownB);
+			int minesB = getHint(b) - getFlaggedNeighbors<STRIDE>(b);
+
+			// split the covered neighbors into shared and unshared cells
+			int shared = 0, countOnlyA = 0, countOnlyB = 0;
+			for (int x = 0; x < countA; x++) {
+				bool inB = false;
+				for (int y = 0; y < countB; y++) {
+					if (unknownA[x] == unknownB[y]) {
+						inB = true;
+					}
+				}
+				if (inB) {
+					shared++;
+				}
+				else {
+					onlyA[countOnlyA++] = unknownA[x];
+				}
+			}
+			for (int y = 0; y < countB; y++) {
+				bool inA = false;
+				for (int x = 0; x < countA; x++) {
+					if (unknownB[y] == unknownA[x]) {
+						inA = true;
+					}
+				}
+				if (!inA) {
+					onlyB[countOnlyB++] = unknownB[y];
+				}
+			}
+
+			if (shared == 0 || countOnlyB == 0) {
+				continue;
+			}
+			if (minesB - minesA == countOnlyB) {
+				flagCells(onlyB, countOnlyB);
+				revealCells(onlyA, countOnlyA);
+				STATS_ADD(PAIR_RULE_HITS, 1);
+				return true;
+			}
+			if (countOnlyA == 0 && minesA == minesB) {
+				revealCells(onlyB, countOnlyB);
+				STATS_ADD(PAIR_RULE_HITS, 1);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/**
+* 
+* double MinesweeperSolver::makeGuess()
+* 
+* Summary: Reveals the covered cell that is least likely to be a mine
+* 
+* Parameters:	none
+* 				
+* Returns:	    double for the chance the revealed cell was a mine
+*
+* Description: Call when solvePuzzle can't find a certain move. Falls back to
+*	a random cell when there is no frontier yet, when a component is too big 
+*	to enumerate, or when the flags on the board can't be right.
+*
+*	Clear all flags prior to calling unless certain that flags are correct.
+*
+**/
+double MinesweeperSolver::makeGuess()
+{
+	STATS_TIMER(GUESS_TIMER);
+	STATS_ADD(GUESSES, 1);
+	TRACE_SPAN("solver", "guess");
+
+	double probability = 0;
+
+	syncBoard();
+	int guess = findSafestCell(probability);
+
+	if (guess >= 0) {
+		board->revealIndex(guess);
+	}
+	else {
+		int covered = board->rows * board->cols - board->revealedCount 
+				- (board->mines - board->flagsRemaining);
+		if (covered > 0) {
+			probability = (double)board->flagsRemaining / covered;
+		}
+		board->revealRandomCell();
+	}
+	syncBoard();
+	return probability;
+}
+
+/**
+* 
+* int MinesweeperSolver::findRoot(int slot)
+* 
+* Summary: Union-find lookup for the group an edge cell belongs to
+* 
+* Parameters:	int for the edge cell's position in edgeCells
+* 				
+* Returns:	    int for the root edge cell of the group
+*
+**/
+int MinesweeperSolver::findRoot(int slot)
+{
+	while (slotParent[slot] != slot) {
+		slotParent[slot] = slotParent[slotParent[slot]];
+		slot = slotParent[slot];
+	}
+	return slot;
+}
+
+/**
+* 
+* void MinesweeperSolver::buildComponents()
+* 
+* Summary: Splits the covered cells next to the frontier into components
+* 
+* Parameters:	none
+* 				
+* Returns:	    void
+*
+* Description: Two covered cells are in the same component if some chain of
+*	frontier hints connects them. Each frontier hint becomes a constraint on 
+*	the component that holds its covered neighbors.
+*
+**/
+void MinesweeperSolver::buildComponents()
+{
+	int unknown[MAX_NEIGHBORS], local[MAX_NEIGHBORS];
+
+	// forget the edge cells from the last call
+	for (size_t i = 0; i < edgeCells.size(); i++) {
+		edgeSlot[edgeCells[i]] = -1;
+	}
+	edgeCells.clear();
+	slotParent.clear();
+
+	// join the covered neighbors of every frontier cell into one group
+	for (size_t i = 0; i < frontierCells.size(); i++) {
+		int count = getUnknownNeighbors<0>(frontierCells[i], unknown);
+
+		for (int k = 0; k < count; k++) {
+			if (edgeSlot[unknown[k]] < 0) {
+				edgeSlot[unknown[k]] = edgeCells.size();
+				slotParent.push_back(edgeCells.size());
+				edgeCells.push_back(unknown[k]);
+			}
+			int rootA = findRoot(edgeSlot[unknown[0]]);
+			int rootB = findRoot(edgeSlot[unknown[k]]);
+			slotParent[rootB] = rootA;
+		}
+	}
+
+	// number the groups and add their cells
+	componentCount = 0;
+	slotComponent.assign(edgeCells.size(), -1);
+	slotLocal.resize(edgeCells.size());
+	for (size_t slot = 0; slot < edgeCells.size(); slot++) {
+		int root = findRoot(slot);
+		if (slotComponent[root] < 0) {
+			slotComponent[root] = componentCount++;
+		}
+		slotComponent[slot] = slotComponent[root];
+	}
+	if ((int)components.size() < componentCount) {
+		components.resize(componentCount);
+	}
+	for (int c = 0; c < componentCount; c++) {
+		components[c].clear();
+	}
+	for (size_t slot = 0; slot < edgeCells.size(); slot++) {
+		slotLocal[slot] = 
+			components[slotComponent[slot]].addCell(edgeCells[slot]);
+	}
+
+	// add one constraint per frontier hint
+	for (size_t i = 0; i < frontierCells.size(); i++) {
+		int idx = frontierCells[i];
+		int count = getUnknownNeighbors<0>(idx, unknown);
+		if (count == 0) {
+			continue;
+		}
+
+		for (int k = 0; k < count; k++) {
+			local[k] = slotLocal[edgeSlot[unknown[k]]];
+		}
+		components[slotComponent[edgeSlot[unknown[0]]]].addConstraint(
+				local, count, getHint(idx) - getFlaggedNeighbors<0>(idx));
+	}
+}
+
+/**
+* 
+* bool MinesweeperSolver::enumerateComponents()
+* 
+* Summary: Enumerates every component, spread across cores
+* 
+* Parameters:	none
+* 				
+* Returns:	    bool - true if every component finished within its budget
+*
+* Description: Components are independent, so each worker takes the next one
+*	that hasn't been started until they are all done. The solver keeps a pool
+*	of one worker per core, started by the first guess that needs it and 
+*	reused by every guess after that. Small frontiers (and every frontier on
+*	a single core) are enumerated on the calling thread since handing them 
+*	to the pool would cost more than the work. Results don't depend on which
+*	thread did the work.
+*
+**/
+bool MinesweeperSolver::enumerateComponents()
+{
+	std::atomic<int> next(0);
+
+	enumerated.assign(componentCount, 0);
+	auto worker = [this, &next](int) {
+		int c;
+		while ((c = next++) < componentCount) {
+			enumerated[c] = components[c].enumerate(NODE_BUDGET);
+		}
+	};
+
+	bool usePool = parallel && componentCount > 1 
+			&& (int)edgeCells.size() >= PARALLEL_CELLS;
+	if (usePool && !pool) {
+		pool = new MinesweeperWorkerPool(0);
+	}
+	if (usePool && pool->getThreadCount() > 1) {
+		pool->run(worker);
+	}
+	else {
+		worker(0);
+	}
+
+	for (int c = 0; c < componentCount; c++) {
+		if (!enumerated[c]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* 
+* int MinesweeperSolver::findSafestCell(double &probability)
+* 
+* Summary: Finds the covered cell with the lowest chance of being a mine
+* 
+* Parameters:	double (reference) to store the chance the cell is a mine
+* 				
+* Returns:	    int for the padded board index of the cell, -1 if there is 
+*				no frontier or the chances can't be worked out
+*
+* Description: Every arrangement of the whole board is one arrangement from
+*	each component plus some placement of the leftover mines in the interior
+*	(covered cells not next to the frontier). If the components hold m mines,
+*	there are C(interior, flagsRemaining - m) ways to place the rest, so each
+*	component arrangement is weighted by that and by the arrangements of the 
+*	other components. Every interior cell has the same chance, so one is 
+*	picked at random if the interior is the safest place.
+*
+**/
+int MinesweeperSolver::findSafestCell(double &probability)
+{
+	buildComponents();
+	if (edgeCells.empty() || !enumerateComponents()) {
+		return -1;
+	}
+
+	int minesLeft = board->flagsRemaining;
+	int interior = board->rows * board->cols - board->revealedCount 
+			- (board->mines - board->flagsRemaining) - edgeCells.size();
+	int maxMines = edgeCells.size();
+
+	// weight of each possible number of mines in the components
+	vector<double> &weight = mineWeights;
+	weight.assign(maxMines + 1, 0);
+	double maxLog = -HUGE_VAL;
+	for (int m = 0; m <= maxMines; m++) {
+		if (minesLeft - m >= 0 && minesLeft - m <= interior) {
+			double logWeight = logChoose(interior, minesLeft - m);
+			if (logWeight > maxLog) {
+				maxLog = logWeight;
+			}
+		}
+	}
+	for (int m = 0; m <= maxMines; m++) {
+		if (minesLeft - m >= 0 && minesLeft - m <= interior) {
+			weight[m] = exp(logChoose(interior, minesLeft - m) - maxLog);
+		}
+	}
+
+	// combine all components
+	vector<double> &total = totalConfigs;
+	total.assign(1, 1.0);
+	for (int c = 0; c < componentCount; c++) {
+		addComponent(total, components[c], combineScratch);
+	}
+	double totalWeight = 0, interiorMines = 0;
+	for (size_t m = 0; m < total.size(); m++) {
+		totalWeight += total[m] * weight[m];
+		interiorMines += total[m] * weight[m] * (minesLeft - (int)m);
+	}
+	if (totalWeight <= 0) {
+		return -1;	// flags on the board can't be right
+	}
+
+	int best = -1;
+	double bestProbability = 2;
+	for (int c = 0; c < componentCount; c++) {
+		MinesweeperComponent &component = components[c];
+
+		// arrangements of every other component
+		vector<double> &others = otherConfigs;
+		others.assign(1, 1.0);
+		for (int o = 0; o < componentCount; o++) {
+			if (o != c) {
+				addComponent(others, components[o], combineScratch);
+			}
+		}
+
+		// weight of each mine count in this component
+		vector<double> &countWeight = countWeights;
+		countWeight.assign(component.getMaxMines() + 1, 0);
+		for (size_t k = 0; k < countWeight.size(); k++) {
+			for (size_t m = 0; m < others.size(); m++) {
+				countWeight[k] += others[m] * weight[k + m];
+			}
+		}
+
+		for (int cell = 0; cell < component.getCellCount(); cell++) {
+			double mineWeight = 0;
+			for (size_t k = 0; k < countWeight.size(); k++) {
+				mineWeight += component.getCellMineCount(k, cell) 
+						* countWeight[k];
+			}
+			double cellProbability = mineWeight / totalWeight;
+			if (cellProbability < bestProbability - 1e-12) {
+				bestProbability = cellProbability;
+				best = component.getCell(cell);
+			}
+		}
+	}
+
+	if (interior > 0) {
+		double interiorProbability = interiorMines / totalWeight / interior;
+		if (interiorProbability < bestProbability - 1e-12) {
+			// all interior cells are equally likely, pick one at random
+			interiorCells.clear();
+			for (int i = 0; i < board->rows; i++) {
+				int idx = board->cellIndex(i, 0);
+				for (int j = 0; j < board->cols; j++, idx++) {
+					if (!board->revealedBits.test(idx) 
+							&& !board->flaggedBits.test(idx) 
+							&& edgeSlot[idx] < 0) {
+						interiorCells.push_back(idx);
+					}
+				}
+			}
+			bestProbability = interiorProbability;
+			best = interiorCells[board->random.range(0, 
+					interiorCells.size() - 1)];
+		}
+	}
+
+	probability = bestProbability;
+	return best;
+}
+
+/**
+* 
+* static void addComponent(vector<double> &total, 
+*		MinesweeperComponent &component, vector<double> &combined)
+* 
+* Summary: Multiplies a component's arrangements into a running total
+* 
+* Parameters:	vector of double - total[m] is the weight of arrangements 
+*				with m mines, updated in place
+*				MinesweeperComponent that has been enumerated
+*				vector of double to use as scratch space
+* 				
+* Returns:	    void
+*
+**/
+static void addComponent(vector<double> &total, 
+		MinesweeperComponent &component, vector<double> &combined)
+{
+	combined.assign(total.size() + component.getMaxMines(), 0);
+
+	for (size_t m = 0; m < total.size(); m++) {
+		if (total[m] == 0) {
+			continue;
+		}
+		for (int k = 0; k <= component.getMaxMines(); k++) {
+			combined[m + k] += total[m] * component.getConfigCount(k);
+		}
+	}
+	total.swap(combined);
+}
+
+/**
+* 
+* static double logChoose(int n, int k)
+* 
+* Summary: Returns the natural log of n choose k
+* 
+* Parameters:	int for n
+*				int for k
+* 				
+* Returns:	    double
+*
+* Description: Uses logs since the interior of a large board has far more
+*	arrangements than a double can hold.
+*
+**/
+static double logChoose(int n, int k)
+{
+	return lgamma(n + 1.0) - lgamma(k + 1.0) - lgamma(n - k + 1.0);
+}
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* File:		MinesweeperSolver.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_SOLVER_HPP
+#define MINESWEEPER_SOLVER_HPP
+
+#include <stddef.h>		// size_t
+#include <vector>
+#include "MinesweeperBitboard.hpp"
+#include "MinesweeperBoard.hpp"
+#include "MinesweeperComponent.hpp"
+#include "MinesweeperWorkerPool.hpp"
+
+class MinesweeperSolver
+{
+	public:
+		MinesweeperSolver(MinesweeperBoard *);
+		~MinesweeperSolver();
+
+		void reset();
+		void setParallel(bool);
+
+		// solver
+		bool solvePuzzle();
+		double makeGuess();
+
+		// getters
+		int getFrontierSize();
+
+	private:
+		static const int NEARBY_COUNT = 24;
+		static const int MAX_NEIGHBORS = 8;
+		static const long NODE_BUDGET = 4000000;	// per component
+		static const int PARALLEL_CELLS = 32;	// cells before using threads
+
+		MinesweeperBoard *board;
+		bool parallel;			// enumerate components on several threads
+		size_t logPosition;		// next unread entry in the board revealLog
+		int knownFlagEdits;		// board flagEdits when flags were last seen
+		std::vector<int> frontierCells;
+		std::vector<int> frontierSlot;	// position in frontierCells or -1
+		std::vector<int> worklist;
+		std::vector<int> settledCells;	// left the frontier next to flags
+		MinesweeperBitboard queuedBits;
+		int nearbyCellOffsets[NEARBY_COUNT];
+
+		// probabilistic guessing
+		std::vector<MinesweeperComponent> components;
+		int componentCount;
+		std::vector<int> edgeCells;		// covered cells next to the frontier
+		std::vector<int> edgeSlot;		// position in edgeCells or -1
+		std::vector<int> slotParent;	// union-find parent per edge cell
+		std::vector<int> slotComponent;
+		std::vector<int> slotLocal;		// cell number within its component
+		std::vector<char> enumerated;
+		std::vector<double> mineWeights, totalConfigs, otherConfigs;
+		std::vector<double> countWeights, combineScratch;
+		std::vector<int> interiorCells;
+		MinesweeperWorkerPool *pool;	// started by the first big guess
+
+		// helper functions
+		void setNearbyCellOffsets();
+		void syncBoard();
+		void queueCell(int);
+		void queueNeighbors(int);
+		void addFrontierCell(int);
+		void removeFrontierCell(int);
+		int getHint(int);
+		template <int> int getUnknownNeighbors(int, int *);
+		template <int> int getFlaggedNeighbors(int);
+		bool flagCells(const int *, int);
+		bool revealCells(const int *, int);
+		template <int> bool applyRules();
+		template <int> bool applySingleCellRules();
+		template <int> bool applyPairRules();
+		int findRoot(int);
+		void buildComponents();
+		bool enumerateComponents();
+		int findSafestCell(double &);
+};
+
+#endif
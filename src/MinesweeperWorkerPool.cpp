@@ -0,0 +1,182 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperWorkerPool.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperWorkerPool class. Keeps
+ *	a fixed set of threads that sleep on a condition variable between jobs,
+ *	so work that is handed out often (guesses, no guess boards) doesn't pay
+ *	to start and join threads each time. A job is one function that every
+ *	worker calls with its own number; workers usually share the work through
+ *	an atomic counter. One job runs at a time.
+ *
+ ******************************************************************************/
+#include <stddef.h>		// size_t
+#include "MinesweeperWorkerPool.hpp"
+
+/**
+*
+* MinesweeperWorkerPool::MinesweeperWorkerPool(int threads)
+*
+* Summary: Constructor. Threads aren't started until the first job
+*
+* Parameters:	int for the number of worker threads, 0 to use every core
+*
+**/
+MinesweeperWorkerPool::MinesweeperWorkerPool(int threads)
+{
+	threadCount = threads;
+	if (threadCount < 1) {
+		threadCount = std::thread::hardware_concurrency();
+	}
+	if (threadCount < 1) {
+		threadCount = 1;
+	}
+	jobNumber = 0;
+	running = 0;
+	stopping = false;
+}
+
+/**
+*
+* MinesweeperWorkerPool::~MinesweeperWorkerPool()
+*
+* Summary: Destructor. Lets the current job finish and joins the threads
+*
+**/
+MinesweeperWorkerPool::~MinesweeperWorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(poolLock);
+		stopping = true;
+	}
+	jobReady.notify_all();
+	for (size_t t = 0; t < threads.size(); t++) {
+		threads[t].join();
+	}
+}
+
+/**
+*
+* void MinesweeperWorkerPool::start(Job job)
+*
+* Summary: Hands a job to every worker and returns without waiting
+*
+* Parameters:	Job to call once on each worker, with the worker's number
+*				(0 to getThreadCount() - 1)
+*
+* Returns:	    void
+*
+* Description: Waits for the last job to finish first. Call wait before
+*	using anything the job writes.
+*
+**/
+void MinesweeperWorkerPool::start(Job job)
+{
+	std::unique_lock<std::mutex> lock(poolLock);
+	jobDone.wait(lock, [this] { return running == 0; });
+
+	if (threads.empty()) {
+		for (int t = 0; t < threadCount; t++) {
+			threads.push_back(std::thread(&MinesweeperWorkerPool::worker,
+					this, t));
+		}
+	}
+	this->job = job;
+	running = threadCount;
+	jobNumber++;
+	lock.unlock();
+	jobReady.notify_all();
+}
+
+/**
+*
+* void MinesweeperWorkerPool::wait()
+*
+* Summary: Waits until every worker has finished the current job
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+**/
+void MinesweeperWorkerPool::wait()
+{
+	std::unique_lock<std::mutex> lock(poolLock);
+	jobDone.wait(lock, [this] { return running == 0; });
+}
+
+/**
+*
+* void MinesweeperWorkerPool::run(Job job)
+*
+* Summary: Runs a job on every worker and waits for it
+*
+* Parameters:	Job to call once on each worker
+*
+* Returns:	    void
+*
+**/
+void MinesweeperWorkerPool::run(Job job)
+{
+	start(job);
+	wait();
+}
+
+/**
+*
+* int MinesweeperWorkerPool::getThreadCount()
+*
+* Summary: Returns the number of workers a job runs on
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperWorkerPool::getThreadCount()
+{
+	return threadCount;
+}
+
+/**
+*
+* void MinesweeperWorkerPool::worker(int thread)
+*
+* Summary: Sleeps until a job is started, runs it and sleeps again
+*
+* Parameters:	int for the worker number
+*
+* Returns:	    void
+*
+* Description: A job started before the destructor is still run, so
+*	start and wait never hang.
+*
+**/
+void MinesweeperWorkerPool::worker(int thread)
+{
+	long jobsSeen = 0;
+
+	while (1) {
+		Job current;
+		{
+			std::unique_lock<std::mutex> lock(poolLock);
+			jobReady.wait(lock, [this, jobsSeen] {
+				return stopping || jobNumber != jobsSeen;
+			});
+			if (jobNumber == jobsSeen) {
+				return;		// stopping with nothing left to do
+			}
+			jobsSeen = jobNumber;
+			current = job;
+		}
+
+		current(thread);
+
+		std::lock_guard<std::mutex> guard(poolLock);
+		if (--running == 0) {
+			jobDone.notify_all();
+		}
+	}
+}
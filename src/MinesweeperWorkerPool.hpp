@@ -0,0 +1,47 @@
+/*******************************************************************************
+* File:		MinesweeperWorkerPool.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_WORKER_POOL_HPP
+#define MINESWEEPER_WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class MinesweeperWorkerPool
+{
+	public:
+		typedef std::function<void(int)> Job;	// called with the worker
+
+		MinesweeperWorkerPool(int);
+		~MinesweeperWorkerPool();
+
+		void start(Job);
+		void wait();
+		void run(Job);
+
+		// getters
+		int getThreadCount();
+
+	private:
+		int threadCount;
+		std::vector<std::thread> threads;	// started by the first job
+
+		// the current job, guarded by poolLock
+		std::mutex poolLock;
+		std::condition_variable jobReady;
+		std::condition_variable jobDone;
+		Job job;
+		long jobNumber;			// jobs started so far
+		int running;			// workers still on the current job
+		bool stopping;			// set by the destructor
+
+		// helper functions
+		void worker(int);
+};
+
+#endif
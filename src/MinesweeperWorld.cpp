@@ -0,0 +1,586 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperWorld.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperWorld class. An endless
+ *	minesweeper board split into 64x64 chunks. A chunk's mines come from a
+ *	generator seeded with a hash of the world seed and the chunk's position,
+ *	so any chunk can be regenerated at any time and nothing about the mines
+ *	ever has to be stored. A chunk only exists in memory once a reveal, a
+ *	flood fill or a flag reaches it, so memory grows with the area explored.
+ *
+ *	When more chunks are resident than the budget allows, the least recently
+ *	used ones are evicted. A chunk the player never touched is just dropped.
+ *	Otherwise its revealed and flagged bits (1 KB) are written to a scratch
+ *	file and read back when the chunk is next used. The scratch file only
+ *	lives as long as the world.
+ *
+ *	Cells use the same chars as MinesweeperBoard. The cells around (0, 0)
+ *	never hold a mine, so revealing the origin always opens an area.
+ *
+ ******************************************************************************/
+#include <stddef.h>		// size_t
+#include <algorithm>	// nth_element
+#include <cstring>		// memset, memcpy
+#include <unistd.h>		// pread, pwrite
+#include "MinesweeperWorld.hpp"
+#include "MinesweeperRandom.hpp"
+#include "minesweeperHints.hpp"
+#include "minesweeperTrace.hpp"
+
+/**
+*
+* MinesweeperWorld::MinesweeperWorld(uint64_t seed, int minesPerChunk,
+*		int maxChunks)
+*
+* Summary: Constructor
+*
+* Parameters:	uint64_t for the seed used to place mines
+*				int for the number of mines in each 64x64 chunk (640 is
+*				about as dense as an expert board, much below 400 and
+*				a single opening can spread without end)
+*				int for the number of chunks to keep in memory (about 6 KB
+*				each) before evicting
+*
+* Description: If the scratch file can't be created, chunks are never
+*	evicted.
+*
+**/
+MinesweeperWorld::MinesweeperWorld(uint64_t seed, int minesPerChunk,
+		int maxChunks)
+{
+	this->seed = seed;
+	this->minesPerChunk = minesPerChunk;
+	this->maxChunks = maxChunks;
+	useClock = 0;
+	revealedCount = 0;
+	flagCount = 0;
+	mineHit = false;
+	store = tmpfile();
+	storeSize = 0;
+	lastChunk = nullptr;
+	minePlane.assign(PADDED_SIZE * PADDED_SIZE, 0);
+}
+
+/**
+*
+* MinesweeperWorld::~MinesweeperWorld()
+*
+* Summary: Destructor. Frees the chunks and removes the scratch file.
+*
+**/
+MinesweeperWorld::~MinesweeperWorld()
+{
+	for (auto it = chunks.begin(); it != chunks.end(); ++it) {
+		delete(it->second);
+	}
+	if (store) {
+		fclose(store);
+	}
+}
+
+/**
+*
+* Status MinesweeperWorld::checkGameState()
+*
+* Summary: Returns the state of the game
+*
+* Parameters:	none
+*
+* Returns:	    Status - LOSE once a mine is revealed, else PENDING. An
+*				endless world can't be won.
+*
+**/
+Status MinesweeperWorld::checkGameState()
+{
+	return mineHit ? LOSE : PENDING;
+}
+
+/**
+*
+* bool MinesweeperWorld::isMine(int row, int col)
+*
+* Summary: Checks if a cell holds a mine
+*
+* Parameters:	int for the row of the cell
+*				int for the col of the cell
+*
+* Returns:	    bool
+*
+* Description: Doesn't create the cell's chunk, so it is safe to call for
+*	cells that were never explored (e.g. to show the mines after a loss).
+*
+**/
+bool MinesweeperWorld::isMine(int row, int col)
+{
+	int idx = ((row & (CHUNK_SIZE - 1)) << CHUNK_SHIFT)
+			| (col & (CHUNK_SIZE - 1));
+	Chunk *chunk = getChunk(row >> CHUNK_SHIFT, col >> CHUNK_SHIFT, false);
+	if (chunk) {
+		return testBit(chunk->mineWords, idx);
+	}
+
+	uint64_t mineWords[CHUNK_WORDS];
+	generateMines(row >> CHUNK_SHIFT, col >> CHUNK_SHIFT, mineWords);
+	return testBit(mineWords, idx);
+}
+
+/**
+*
+* void MinesweeperWorld::revealCell(int row, int col)
+*
+* Summary: Reveals a cell and flood fills from it
+*
+* Parameters:	int for the row of the cell
+*				int for the col of the cell
+*
+* Returns:	    void
+*
+* Description: Breadth first, like MinesweeperBoard::revealIndex, creating
+*	chunks as the fill reaches them. Chunks are only evicted once the fill
+*	is done, so a very large opening can go over the memory budget until
+*	then.
+*
+**/
+void MinesweeperWorld::revealCell(int row, int col)
+{
+	TRACE_SPAN("board", "reveal");
+
+	useClock++;
+	Chunk *chunk = getChunk(row >> CHUNK_SHIFT, col >> CHUNK_SHIFT, true);
+	int idx = ((row & (CHUNK_SIZE - 1)) << CHUNK_SHIFT)
+			| (col & (CHUNK_SIZE - 1));
+
+	if (testBit(chunk->revealedWords, idx)
+			|| testBit(chunk->flaggedWords, idx)) {
+		return;
+	}
+
+	setBit(chunk->revealedWords, idx);
+	revealQueue.clear();
+	revealQueue.push_back(std::make_pair(row, col));
+
+	for (size_t head = 0; head < revealQueue.size(); head++) {
+		int cellRow = revealQueue[head].first;
+		int cellCol = revealQueue[head].second;
+		chunk = getChunk(cellRow >> CHUNK_SHIFT, cellCol >> CHUNK_SHIFT, true);
+		int localRow = cellRow & (CHUNK_SIZE - 1);
+		int localCol = cellCol & (CHUNK_SIZE - 1);
+		char hint = chunk->hints[(localRow + 1) * PADDED_SIZE + localCol + 1];
+
+		revealedCount++;
+		if (hint == '*') {
+			mineHit = true;
+			continue;
+		}
+		if (hint != '0') {
+			continue;
+		}
+
+		// open every covered neighbor of a blank cell
+		for (int i = cellRow - 1; i <= cellRow + 1; i++) {
+			for (int j = cellCol - 1; j <= cellCol + 1; j++) {
+				Chunk *neighbor = getChunk(i >> CHUNK_SHIFT,
+						j >> CHUNK_SHIFT, true);
+				int neighborIdx = ((i & (CHUNK_SIZE - 1)) << CHUNK_SHIFT)
+						| (j & (CHUNK_SIZE - 1));
+				if (!testBit(neighbor->revealedWords, neighborIdx)
+						&& !testBit(neighbor->flaggedWords, neighborIdx)) {
+					setBit(neighbor->revealedWords, neighborIdx);
+					revealQueue.push_back(std::make_pair(i, j));
+				}
+			}
+		}
+	}
+	evictChunks();
+}
+
+/**
+*
+* void MinesweeperWorld::flipCellFlag(int row, int col)
+*
+* Summary: Flags a covered cell, or unflags a flagged one
+*
+* Parameters:	int for the row of the cell
+*				int for the col of the cell
+*
+* Returns:	    void
+*
+**/
+void MinesweeperWorld::flipCellFlag(int row, int col)
+{
+	TRACE_SPAN("board", "flag");
+
+	useClock++;
+	Chunk *chunk = getChunk(row >> CHUNK_SHIFT, col >> CHUNK_SHIFT, true);
+	int idx = ((row & (CHUNK_SIZE - 1)) << CHUNK_SHIFT)
+			| (col & (CHUNK_SIZE - 1));
+
+	if (testBit(chunk->revealedWords, idx)) {
+		return;
+	}
+	if (testBit(chunk->flaggedWords, idx)) {
+		resetBit(chunk->flaggedWords, idx);
+		flagCount--;
+	}
+	else {
+		setBit(chunk->flaggedWords, idx);
+		flagCount++;
+	}
+	evictChunks();
+}
+
+/**
+*
+* char MinesweeperWorld::getPlayerCell(int row, int col)
+*
+* Summary: Returns the display char of a cell
+*
+* Parameters:	int for the row of the cell
+*				int for the col of the cell
+*
+* Returns:	    char - '?' flagged, '-' covered, ' ' blank, '*' mine or
+*				'1'-'8' hint
+*
+* Description: Cells of chunks that were never explored are covered, and
+*	reading them doesn't create the chunk.
+*
+**/
+char MinesweeperWorld::getPlayerCell(int row, int col)
+{
+	Chunk *chunk = getChunk(row >> CHUNK_SHIFT, col >> CHUNK_SHIFT, false);
+	if (!chunk) {
+		return '-';
+	}
+
+	int localRow = row & (CHUNK_SIZE - 1);
+	int localCol = col & (CHUNK_SIZE - 1);
+	int idx = (localRow << CHUNK_SHIFT) | localCol;
+	if (testBit(chunk->flaggedWords, idx)) {
+		return '?';
+	}
+	if (!testBit(chunk->revealedWords, idx)) {
+		return '-';
+	}
+
+	char hint = chunk->hints[(localRow + 1) * PADDED_SIZE + localCol + 1];
+	return hint == '0' ? ' ' : hint;
+}
+
+/**
+*
+* long MinesweeperWorld::getRevealedCount()
+*
+* Summary: Returns the number of cells revealed so far
+*
+* Parameters:	none
+*
+* Returns:	    long
+*
+**/
+long MinesweeperWorld::getRevealedCount()
+{
+	return revealedCount;
+}
+
+/**
+*
+* long MinesweeperWorld::getFlagCount()
+*
+* Summary: Returns the number of flags placed
+*
+* Parameters:	none
+*
+* Returns:	    long
+*
+**/
+long MinesweeperWorld::getFlagCount()
+{
+	return flagCount;
+}
+
+/**
+*
+* int MinesweeperWorld::getResidentChunks()
+*
+* Summary: Returns the number of chunks in memory
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperWorld::getResidentChunks()
+{
+	return chunks.size();
+}
+
+/**
+*
+* int MinesweeperWorld::getStoredChunks()
+*
+* Summary: Returns the number of chunks that have been written to disk
+*
+* Parameters:	none
+*
+* Returns:	    int
+*
+**/
+int MinesweeperWorld::getStoredChunks()
+{
+	return storedOffsets.size();
+}
+
+/**
+*
+* MinesweeperWorld::Chunk *MinesweeperWorld::loadChunk(int chunkRow,
+*		int chunkCol, bool create)
+*
+* Summary: Finds a chunk that isn't the last one used
+*
+* Parameters:	int for the chunk row (cell row / 64, rounded down)
+*				int for the chunk col
+*				bool - true to create the chunk if it was never explored
+*
+* Returns:	    Chunk, or nullptr if it was never explored and create is
+*				false
+*
+* Description: An evicted chunk is read back from the scratch file. Mines
+*	and hints are regenerated every time a chunk is brought into memory.
+*
+**/
+MinesweeperWorld::Chunk *MinesweeperWorld::loadChunk(int chunkRow,
+		int chunkCol, bool create)
+{
+	uint64_t key = chunkKey(chunkRow, chunkCol);
+
+	auto resident = chunks.find(key);
+	if (resident != chunks.end()) {
+		lastChunk = resident->second;
+		lastChunk->lastUsed = useClock;
+		return lastChunk;
+	}
+
+	auto stored = storedOffsets.find(key);
+	if (stored == storedOffsets.end() && !create) {
+		return nullptr;
+	}
+
+	Chunk *chunk = new Chunk;
+	chunk->chunkRow = chunkRow;
+	chunk->chunkCol = chunkCol;
+	chunk->lastUsed = useClock;
+	memset(chunk->revealedWords, 0, sizeof(chunk->revealedWords));
+	memset(chunk->flaggedWords, 0, sizeof(chunk->flaggedWords));
+	if (stored != storedOffsets.end()) {
+		int fd = fileno(store);
+		off_t offset = stored->second;
+		if (pread(fd, chunk->revealedWords, sizeof(chunk->revealedWords),
+					offset) != sizeof(chunk->revealedWords)
+				|| pread(fd, chunk->flaggedWords, sizeof(chunk->flaggedWords),
+					offset + sizeof(chunk->revealedWords))
+						!= sizeof(chunk->flaggedWords)) {
+			// a failed read loses the chunk's progress, not the game
+			memset(chunk->revealedWords, 0, sizeof(chunk->revealedWords));
+			memset(chunk->flaggedWords, 0, sizeof(chunk->flaggedWords));
+		}
+	}
+	generateMines(chunkRow, chunkCol, chunk->mineWords);
+	setHints(chunk);
+
+	chunks[key] = chunk;
+	lastChunk = chunk;
+	return chunk;
+}
+
+/**
+*
+* void MinesweeperWorld::generateMines(int chunkRow, int chunkCol,
+*		uint64_t *mineWords)
+*
+* Summary: Places the mines of a chunk
+*
+* Parameters:	int for the chunk row
+*				int for the chunk col
+*				uint64_t array of CHUNK_WORDS words to fill, bit
+*				row * 64 + col is set for a mine
+*
+* Returns:	    void
+*
+* Description: Uses Floyd's sampling algorithm like MinesweeperBoard, with a
+*	generator seeded from the world seed and the chunk position, so the same
+*	chunk always gets the same mines. The cells around the origin are
+*	cleared afterwards.
+*
+**/
+void MinesweeperWorld::generateMines(int chunkRow, int chunkCol,
+		uint64_t *mineWords)
+{
+	const int cells = CHUNK_SIZE * CHUNK_SIZE;
+	MinesweeperRandom random(seed
+			^ (chunkKey(chunkRow, chunkCol) * 0x9e3779b97f4a7c15ULL));
+
+	memset(mineWords, 0, CHUNK_WORDS * sizeof(uint64_t));
+	for (int j = cells - minesPerChunk; j < cells; j++) {
+		int choice = random.range(0, j);
+		setBit(mineWords, testBit(mineWords, choice) ? j : choice);
+	}
+
+	for (int i = -1; i <= 1; i++) {
+		for (int j = -1; j <= 1; j++) {
+			if ((i >> CHUNK_SHIFT) == chunkRow
+					&& (j >> CHUNK_SHIFT) == chunkCol) {
+				resetBit(mineWords, ((i & (CHUNK_SIZE - 1)) << CHUNK_SHIFT)
+						| (j & (CHUNK_SIZE - 1)));
+			}
+		}
+	}
+}
+
+/**
+*
+* void MinesweeperWorld::setHints(Chunk *chunk)
+*
+* Summary: Computes the hints of a chunk
+*
+* Parameters:	Chunk with its mines placed
+*
+* Returns:	    void
+*
+* Description: Builds a padded mine plane for the chunk whose border holds
+*	the edge mines of the 8 chunks around it, then runs the board's hint
+*	kernel over it. Neighbors that aren't in memory have their mines
+*	generated but are not created.
+*
+**/
+void MinesweeperWorld::setHints(Chunk *chunk)
+{
+	uint64_t generated[9][CHUNK_WORDS];
+	const uint64_t *neighborMines[9];
+
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			int neighborRow = chunk->chunkRow + i - 1;
+			int neighborCol = chunk->chunkCol + j - 1;
+			auto resident = chunks.find(chunkKey(neighborRow, neighborCol));
+
+			if (i == 1 && j == 1) {
+				neighborMines[4] = chunk->mineWords;
+			}
+			else if (resident != chunks.end()) {
+				neighborMines[i * 3 + j] = resident->second->mineWords;
+			}
+			else {
+				generateMines(neighborRow, neighborCol, generated[i * 3 + j]);
+				neighborMines[i * 3 + j] = generated[i * 3 + j];
+			}
+		}
+	}
+
+	for (int i = 0; i < PADDED_SIZE; i++) {
+		int chunkOffsetRow = (i == 0) ? 0 : (i == PADDED_SIZE - 1) ? 2 : 1;
+		int localRow = (i - 1) & (CHUNK_SIZE - 1);
+		for (int j = 0; j < PADDED_SIZE; j++) {
+			int chunkOffsetCol = (j == 0) ? 0 : (j == PADDED_SIZE - 1) ? 2 : 1;
+			int localCol = (j - 1) & (CHUNK_SIZE - 1);
+			minePlane[i * PADDED_SIZE + j] = testBit(
+					neighborMines[chunkOffsetRow * 3 + chunkOffsetCol],
+					(localRow << CHUNK_SHIFT) | localCol);
+		}
+	}
+
+	countNeighborMines(minePlane.data(), chunk->hints, CHUNK_SIZE, CHUNK_SIZE,
+			PADDED_SIZE);
+}
+
+/**
+*
+* void MinesweeperWorld::evictChunks()
+*
+* Summary: Moves the least recently used chunks out of memory
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+* Description: Once the budget is exceeded, evicts down to three quarters
+*	of it, so the cost of choosing chunks is shared by many evictions.
+*
+**/
+void MinesweeperWorld::evictChunks()
+{
+	if (!store || (int)chunks.size() <= maxChunks) {
+		return;
+	}
+
+	evictOrder.clear();
+	for (auto it = chunks.begin(); it != chunks.end(); ++it) {
+		evictOrder.push_back(it->second);
+	}
+	size_t evictCount = chunks.size() - maxChunks * 3 / 4;
+	std::nth_element(evictOrder.begin(), evictOrder.begin() + evictCount,
+			evictOrder.end(), [](const Chunk *a, const Chunk *b) {
+				return a->lastUsed < b->lastUsed;
+			});
+
+	for (size_t i = 0; i < evictCount; i++) {
+		Chunk *chunk = evictOrder[i];
+		if (saveChunk(chunk)) {
+			chunks.erase(chunkKey(chunk->chunkRow, chunk->chunkCol));
+			delete(chunk);
+		}
+	}
+	lastChunk = nullptr;
+}
+
+/**
+*
+* bool MinesweeperWorld::saveChunk(Chunk *chunk)
+*
+* Summary: Writes a chunk's player state to the scratch file
+*
+* Parameters:	Chunk to save
+*
+* Returns:	    bool - true if the chunk can be dropped from memory
+*
+* Description: Chunks with nothing revealed or flagged are not written
+*	unless they were written before. A chunk keeps its place in the file,
+*	so the file grows only with the number of chunks explored.
+*
+**/
+bool MinesweeperWorld::saveChunk(Chunk *chunk)
+{
+	uint64_t key = chunkKey(chunk->chunkRow, chunk->chunkCol);
+	auto stored = storedOffsets.find(key);
+
+	bool touched = false;
+	for (int i = 0; i < CHUNK_WORDS && !touched; i++) {
+		touched = chunk->revealedWords[i] | chunk->flaggedWords[i];
+	}
+	if (!touched && stored == storedOffsets.end()) {
+		return true;
+	}
+
+	long offset = storeSize;
+	if (stored != storedOffsets.end()) {
+		offset = stored->second;
+	}
+
+	int fd = fileno(store);
+	if (pwrite(fd, chunk->revealedWords, sizeof(chunk->revealedWords),
+				offset) != sizeof(chunk->revealedWords)
+			|| pwrite(fd, chunk->flaggedWords, sizeof(chunk->flaggedWords),
+				offset + sizeof(chunk->revealedWords))
+					!= sizeof(chunk->flaggedWords)) {
+		return false;	// keep it in memory instead
+	}
+
+	if (stored == storedOffsets.end()) {
+		storedOffsets[key] = offset;
+		storeSize += sizeof(chunk->revealedWords)
+				+ sizeof(chunk->flaggedWords);
+	}
+	return true;
+}
@@ -0,0 +1,116 @@
+/*******************************************************************************
+* File:		MinesweeperWorld.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_WORLD_HPP
+#define MINESWEEPER_WORLD_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+#include <utility>	// pair
+#include <vector>
+#include "MinesweeperGameStatus.hpp"
+
+class MinesweeperWorld
+{
+	public:
+		MinesweeperWorld(uint64_t, int, int);
+		~MinesweeperWorld();
+
+		// game checks
+		Status checkGameState();
+		bool isMine(int, int);
+
+		// setters (modify world)
+		void revealCell(int, int);
+		void flipCellFlag(int, int);
+
+		// getters
+		char getPlayerCell(int, int);
+		long getRevealedCount();
+		long getFlagCount();
+		int getResidentChunks();
+		int getStoredChunks();
+
+		static const int CHUNK_SHIFT = 6;
+		static const int CHUNK_SIZE = 1 << CHUNK_SHIFT;		// 64x64 cells
+
+	private:
+		static const int CHUNK_WORDS = CHUNK_SIZE * CHUNK_SIZE / 64;
+		static const int PADDED_SIZE = CHUNK_SIZE + 2;		// hint plane row
+
+		struct Chunk
+		{
+			int chunkRow, chunkCol;
+			uint64_t lastUsed;		// useClock when last touched
+			uint64_t mineWords[CHUNK_WORDS];
+			uint64_t revealedWords[CHUNK_WORDS];
+			uint64_t flaggedWords[CHUNK_WORDS];
+			char hints[PADDED_SIZE * PADDED_SIZE];	// padded, like a board
+		};
+
+		uint64_t seed;
+		int minesPerChunk;
+		int maxChunks;			// resident chunks before eviction
+		uint64_t useClock;
+		long revealedCount, flagCount;
+		bool mineHit;
+		std::unordered_map<uint64_t, Chunk *> chunks;		// resident
+		std::unordered_map<uint64_t, long> storedOffsets;	// evicted
+		FILE *store;			// evicted player state
+		long storeSize;
+		Chunk *lastChunk;		// most recent lookup
+		std::vector<std::pair<int, int>> revealQueue;
+		std::vector<char> minePlane;
+		std::vector<Chunk *> evictOrder;
+
+		// helper functions
+		static uint64_t chunkKey(int, int);
+		Chunk *getChunk(int, int, bool);
+		Chunk *loadChunk(int, int, bool);
+		void generateMines(int, int, uint64_t *);
+		void setHints(Chunk *);
+		void evictChunks();
+		bool saveChunk(Chunk *);
+		static bool testBit(const uint64_t *, int);
+		static void setBit(uint64_t *, int);
+		static void resetBit(uint64_t *, int);
+};
+
+// packs signed chunk coordinates into a single map key
+inline uint64_t MinesweeperWorld::chunkKey(int chunkRow, int chunkCol)
+{
+	return ((uint64_t)(uint32_t)chunkRow << 32) | (uint32_t)chunkCol;
+}
+
+// returns the chunk holding a chunk row and col, loading or creating it if
+// needed (see loadChunk)
+inline MinesweeperWorld::Chunk *MinesweeperWorld::getChunk(int chunkRow,
+		int chunkCol, bool create)
+{
+	if (lastChunk && lastChunk->chunkRow == chunkRow
+			&& lastChunk->chunkCol == chunkCol) {
+		lastChunk->lastUsed = useClock;
+		return lastChunk;
+	}
+	return loadChunk(chunkRow, chunkCol, create);
+}
+
+inline bool MinesweeperWorld::testBit(const uint64_t *words, int idx)
+{
+	return (words[idx >> 6] >> (idx & 63)) & 1;
+}
+
+inline void MinesweeperWorld::setBit(uint64_t *words, int idx)
+{
+	words[idx >> 6] |= (uint64_t)1 << (idx & 63);
+}
+
+inline void MinesweeperWorld::resetBit(uint64_t *words, int idx)
+{
+	words[idx >> 6] &= ~((uint64_t)1 << (idx & 63));
+}
+
+#endif
@@ -0,0 +1,368 @@
+/*******************************************************************************
+ *
+ * File:	MinesweeperWorldGame.cpp
+ * Author:	Kelley Neubauer
+ * Date:	10/17/2026
+ *
+ * Description: Implementation file for the MinesweeperWorldGame class. Runs
+ *	the infinite game. It interacts with a MinesweeperWorld object to manage
+ *	the endless board and a MinesweeperDisplay object to show a window of it
+ *	that scrolls when the cursor is pushed past its edge.
+ *
+ *	The game ends when a mine is revealed, the score is the number of cells
+ *	revealed. The solver, random reveals, saving and move logs only work on
+ *	a MinesweeperBoard, so they aren't offered here.
+ *
+ ******************************************************************************/
+#include <cstdio>		// snprintf
+#include <ncurses.h>
+#include <unistd.h>		// STDIN_FILENO
+#include "MinesweeperWorldGame.hpp"
+#include "minesweeperStats.hpp"
+#include "minesweeperTrace.hpp"
+
+typedef std::chrono::steady_clock Clock;
+
+static const int MINES_PER_CHUNK = 640;		// about expert density
+static const int MAX_CHUNKS = 4096;			// about 24 MB resident
+static const char *STATS_FILE = "minesweeper.stats.json";
+
+/**
+*
+* MinesweeperWorldGame::MinesweeperWorldGame(uint64_t seed)
+*
+* Summary: Constructor
+*
+* Parameters:	uint64_t for the seed used to place mines
+*
+* Description: The cursor starts on the world's origin, which always opens
+*	an area when revealed.
+*
+**/
+MinesweeperWorldGame::MinesweeperWorldGame(uint64_t seed)
+{
+	gameState = PENDING;
+	startTime = endTime = Clock::now();
+	world = new MinesweeperWorld(seed, MINES_PER_CHUNK, MAX_CHUNKS);
+	gameDisplay = new MinesweeperDisplay(VIEW_ROWS, VIEW_COLS);
+	eventLoop = new MinesweeperEventLoop();
+	viewRow = -VIEW_ROWS / 2;
+	viewCol = -VIEW_COLS / 2;
+	gameDisplay->setCursorPosition(-viewRow, -viewCol);
+}
+
+/**
+*
+* MinesweeperWorldGame::~MinesweeperWorldGame()
+*
+* Summary: Destructor. Frees dynamically allocated memory
+*
+**/
+MinesweeperWorldGame::~MinesweeperWorldGame()
+{
+	delete(eventLoop);
+	delete(world);
+	delete(gameDisplay);
+}
+
+/**
+*
+* void MinesweeperWorldGame::startGame()
+*
+* Summary: Starts the infinite game
+*
+* Parameters:	none
+*
+* Returns:	   	void
+*
+* Description: Runs the same single threaded event loop as
+*	MinesweeperGame::startGame until a mine is revealed or the user quits.
+*
+**/
+void MinesweeperWorldGame::startGame()
+{
+	printViewport();
+	gameDisplay->printFlags(0);
+	gameDisplay->printTime(0);
+
+	startTime = Clock::now();
+	int timer = eventLoop->addTimer(startTime + std::chrono::seconds(1),
+			std::chrono::seconds(1), [this] { printElapsedTime(); });
+	eventLoop->addReader(STDIN_FILENO, [this] { handleInput(); });
+	eventLoop->run();
+	eventLoop->removeSource(STDIN_FILENO);
+	eventLoop->removeSource(timer);
+
+	if (getGameState() == PENDING) {	// input was closed
+		setGameState(LOSE);
+	}
+
+	char message[96];
+	printViewportMines();
+	snprintf(message, sizeof(message),
+			"GAME OVER - %ld cells revealed (%.3f seconds)",
+			world->getRevealedCount(), getGameSeconds());
+	gameDisplay->printGameMessage(message);
+	writeStats(STATS_FILE);		// only in stats builds
+}
+
+/**
+*
+* void MinesweeperWorldGame::handleInput()
+*
+* Summary: Handles every key the user has typed
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+* Description: Called by the event loop when input arrives. Stops the loop
+*	once the game is over.
+*
+**/
+void MinesweeperWorldGame::handleInput()
+{
+	int ch;
+
+	while (getGameState() == PENDING
+			&& (ch = gameDisplay->getPendingInput()) != ERR) {
+		handleKey(ch);
+	}
+	if (getGameState() != PENDING) {
+		eventLoop->stop();
+	}
+}
+
+/**
+*
+* void MinesweeperWorldGame::handleKey(int ch)
+*
+* Summary: Carries out a single command from the user
+*
+* Parameters:	int for the key pressed
+*
+* Returns:	    void
+*
+**/
+void MinesweeperWorldGame::handleKey(int ch)
+{
+	STATS_TIMER(INPUT_TIMER);
+	STATS_ADD(KEYS_HANDLED, 1);
+	TRACE_SPAN_ARG("input", "key", "key", ch);
+
+	int row = viewRow + gameDisplay->getCursorRow();
+	int col = viewCol + gameDisplay->getCursorCol();
+
+	switch (ch) {
+		case KEY_LEFT:
+		case 'h':
+			moveCursorInWorld(0, -1);
+			break;
+		case KEY_RIGHT:
+		case 'l':
+			moveCursorInWorld(0, 1);
+			break;
+		case KEY_UP:
+		case 'k':
+			moveCursorInWorld(-1, 0);
+			break;
+		case KEY_DOWN:
+		case 'j':
+			moveCursorInWorld(1, 0);
+			break;
+		case 'g':		// reveal cell
+			world->revealCell(row, col);
+			setGameState(world->checkGameState());
+			printViewport();
+			break;
+		case 'f':		// flag cell
+			world->flipCellFlag(row, col);
+			printViewport();
+			gameDisplay->printFlags(world->getFlagCount());
+			break;
+		case '?':		// help
+			gameDisplay->printGameMessage(
+				"[arrow keys] - navigate, the board scrolls at its edges\n"
+				"[hjkl] - navigate (alternate method using vim keys)\n"
+				"[g] - reveal selected\n"
+				"[f] - flag selected\n"
+				"[?] - help menu\n"
+				"[q] - quit\n"
+				"\n"
+				"The board never ends. Reveal as much as you can\n"
+				"before you hit a mine.");
+			break;
+		case 'q':		// user has quit game
+			setGameState(LOSE);
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+*
+* void MinesweeperWorldGame::printElapsedTime()
+*
+* Summary: Prints the whole seconds played so far
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+* Description: Called by the event loop once a second.
+*
+**/
+void MinesweeperWorldGame::printElapsedTime()
+{
+	TRACE_SPAN("timer", "tick");
+	gameDisplay->printTime((int)getGameSeconds());
+}
+
+/**
+*
+* double MinesweeperWorldGame::getGameSeconds()
+*
+* Summary: Returns how long the game has been played
+*
+* Parameters:	none
+*
+* Returns:	    double for the time in seconds
+*
+**/
+double MinesweeperWorldGame::getGameSeconds()
+{
+	Clock::time_point end = (gameState == PENDING) ? Clock::now() : endTime;
+
+	return std::chrono::duration<double>(end - startTime).count();
+}
+
+/**
+*
+* void MinesweeperWorldGame::printViewport()
+*
+* Summary: Redraws the part of the world that is on screen
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+* Description: Every cell on screen is read from the world, but the display
+*	only draws the ones that changed, so a reveal or a one cell scroll stays
+*	cheap. A flood fill can open cells off screen, which are drawn when
+*	they are scrolled to.
+*
+**/
+void MinesweeperWorldGame::printViewport()
+{
+	for (int i = 0; i < VIEW_ROWS; i++) {
+		for (int j = 0; j < VIEW_COLS; j++) {
+			gameDisplay->setBoardCell(i, j,
+					world->getPlayerCell(viewRow + i, viewCol + j));
+		}
+	}
+	gameDisplay->printBoardChanges();
+}
+
+/**
+*
+* void MinesweeperWorldGame::printViewportMines()
+*
+* Summary: Shows the mines that are on screen after the game ends
+*
+* Parameters:	none
+*
+* Returns:	    void
+*
+* Description: Flagged mines keep their flag. Cells that were never
+*	explored are generated for the check but not kept.
+*
+**/
+void MinesweeperWorldGame::printViewportMines()
+{
+	for (int i = 0; i < VIEW_ROWS; i++) {
+		for (int j = 0; j < VIEW_COLS; j++) {
+			if (world->isMine(viewRow + i, viewCol + j)
+					&& world->getPlayerCell(viewRow + i, viewCol + j)
+							!= '?') {
+				gameDisplay->setBoardCell(i, j, '*');
+			}
+		}
+	}
+	gameDisplay->printBoardChanges();
+}
+
+/**
+*
+* void MinesweeperWorldGame::moveCursorInWorld(int rowChange, int colChange)
+*
+* Summary: Moves the cursor based on user input
+*
+* Parameters:	int for the row change from current
+*				int for the col change from current
+*
+* Returns:	    void
+*
+* Description: When the move would leave the screen, the cursor stays put
+*	and the viewport scrolls by one cell instead.
+*
+**/
+void MinesweeperWorldGame::moveCursorInWorld(int rowChange, int colChange)
+{
+	int row = gameDisplay->getCursorRow() + rowChange;
+	int col = gameDisplay->getCursorCol() + colChange;
+	bool scrolled = false;
+
+	if (row < 0 || row >= VIEW_ROWS) {
+		viewRow += rowChange;
+		row -= rowChange;
+		scrolled = true;
+	}
+	if (col < 0 || col >= VIEW_COLS) {
+		viewCol += colChange;
+		col -= colChange;
+		scrolled = true;
+	}
+
+	gameDisplay->setCursorPosition(row, col);
+	if (scrolled) {
+		printViewport();
+	}
+}
+
+/**
+*
+* void MinesweeperWorldGame::setGameState(Status newStatus)
+*
+* Summary: Modifies gameState member variable
+*
+* Parameters:	Status for the new game state
+*
+* Returns:	    void
+*
+* Description: Records when the game ends.
+*
+**/
+void MinesweeperWorldGame::setGameState(Status newStatus)
+{
+	if (gameState == PENDING && newStatus != PENDING) {
+		endTime = Clock::now();
+	}
+	gameState = newStatus;
+}
+
+/**
+*
+* Status MinesweeperWorldGame::getGameState()
+*
+* Summary: Returns gameState member variable
+*
+* Parameters:	none
+*
+* Returns:	    Status for the current game state
+*
+**/
+Status MinesweeperWorldGame::getGameState()
+{
+	return gameState;
+}
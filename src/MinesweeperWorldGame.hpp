@@ -0,0 +1,47 @@
+/*******************************************************************************
+* File:		MinesweeperWorldGame.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_WORLD_GAME_HPP
+#define MINESWEEPER_WORLD_GAME_HPP
+
+#include <chrono>
+#include <cstdint>
+#include "MinesweeperDisplay.hpp"
+#include "MinesweeperEventLoop.hpp"
+#include "MinesweeperWorld.hpp"
+#include "MinesweeperGameStatus.hpp"
+
+class MinesweeperWorldGame
+{
+	public:
+		MinesweeperWorldGame(uint64_t);
+		~MinesweeperWorldGame();
+
+		void startGame();
+		double getGameSeconds();
+
+		static const int VIEW_ROWS = 16;	// cells shown on screen
+		static const int VIEW_COLS = 40;
+
+	private:
+		MinesweeperWorld *world;
+		MinesweeperDisplay *gameDisplay;
+		MinesweeperEventLoop *eventLoop;
+		int viewRow, viewCol;	// world cell at the top left of the screen
+		Status gameState;
+		std::chrono::steady_clock::time_point startTime, endTime;
+
+		// helper functions
+		void handleInput();
+		void handleKey(int);
+		void printElapsedTime();
+		void printViewport();
+		void printViewportMines();
+		void moveCursorInWorld(int, int);
+		void setGameState(Status);
+		Status getGameState();
+};
+
+#endif
@@ -6,10 +6,39 @@
 * Description: 
 * 
 * 	This file contains code that creates and runs an instance of Minesweeper
+*
+*	Usage: minesweeper [saved game]
+*	       minesweeper --board <rows> <cols> <mines>
+*	       minesweeper --no-guess
+*	       minesweeper --replay <move log> [--speed <times faster>]
+*	       minesweeper --trace <trace file> [any of the above]
+*
+*	A saved game (see the [w] key) or a custom board is played before the 
+*	menu is shown. Boards too big for the terminal scroll with the cursor.
+*	Every new game records its moves to minesweeper.moves, which --replay 
+*	plays back in real time (or faster with --speed).
+*
+*	With --no-guess, the levels are played on boards the solver can finish
+*	without guessing, starting from a cell that is revealed for you. The 
+*	next round's board is found in the background while you play.
+*
+*	With --trace, the session is recorded as a Chrome trace (input waits,
+*	board changes, solver passes, drawing and timer ticks on every thread)
+*	and written to the trace file on exit. Open it in chrome://tracing or
+*	ui.perfetto.dev.
 * 
 *******************************************************************************/
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>		// atof, atoi
+#include <cstring>		// strcmp
 #include "minesweeperMenus.hpp"
 #include "MinesweeperGame.hpp"
+#include "MinesweeperSnapshot.hpp"
+#include "MinesweeperWorldGame.hpp"
+#include "MinesweeperGenerator.hpp"
+#include "minesweeperTrace.hpp"
+#include "minesweeperUtils.hpp"
 
 // beginner: 10x10, 10 mines
 #define BEGINNER_ROWS 		10
@@ -24,26 +53,94 @@
 #define EXPERT_COLS 		40
 #define EXPERT_MINES 		99
 
-int main()
+// spans kept by --trace, the newest are kept once it is full (about 15 MB)
+#define TRACE_SPANS			262144
+
+static int playMain(int, char *[]);
+static int traceMain(int, char *[]);
+static int replayMain(int, char *[]);
+static int boardMain(int, char *[], MinesweeperGame *&);
+
+int main(int argc, char *argv[])
+{
+	if (argc > 2 && strcmp(argv[1], "--trace") == 0) {
+		return traceMain(argc, argv);
+	}
+	return playMain(argc, argv);
+}
+
+/**
+* 
+* static int playMain(int argc, char *argv[])
+* 
+* Summary: Plays a saved game, a custom board or the menu's levels
+* 
+* Parameters:	int and char* array for the command line
+* 				
+* Returns:	    int for the exit status
+*
+**/
+static int playMain(int argc, char *argv[])
 {
+	MinesweeperGame *game = nullptr;	// reset for each new round
+	MinesweeperGenerator *generator = nullptr;	// no guess boards
+	MenuChoice generatorLevel = EXIT;	// level the generator is sized for
+	bool noGuess = false;
+
+	if (argc > 1 && strcmp(argv[1], "--replay") == 0) {
+		return replayMain(argc, argv);
+	}
+	if (argc > 1 && strcmp(argv[1], "--board") == 0) {
+		if (boardMain(argc, argv, game) != 0) {
+			return 1;
+		}
+	}
+	else if (argc == 2 && strcmp(argv[1], "--no-guess") == 0) {
+		noGuess = true;
+	}
+	else if (argc > 1) {
+		// restore checks the file, so a damaged save never reaches the game
+		MinesweeperSnapshot snapshot;
+		MinesweeperBoard *board = new MinesweeperBoard(1, 1, 0, 0);
+		if (!snapshot.open(argv[1]) || !board->restore(snapshot)) {
+			fprintf(stderr, "%s is not a saved minesweeper game\n", argv[1]);
+			delete(board);
+			return 1;
+		}
+		snapshot.close();
+
+		game = new MinesweeperGame(board);
+		game->startGame();
+	}
+
 	while (1) {
-		MinesweeperGame *newGame = nullptr;
+		int rows = 0, cols = 0, mines = 0;
 
 		// run menu and process user choice
 		MenuChoice choice = mainMenu();
 		switch (choice) {
 			case BEGINNER:		
-				newGame = new MinesweeperGame(
-					BEGINNER_ROWS, BEGINNER_COLS, BEGINNER_MINES);
+				rows = BEGINNER_ROWS;
+				cols = BEGINNER_COLS;
+				mines = BEGINNER_MINES;
 				break;
 			case INTERMEDIATE:		
-				newGame = new MinesweeperGame(
-					INTERMEDIATE_ROWS, INTERMEDIATE_COLS, INTERMEDIATE_MINES);
+				rows = INTERMEDIATE_ROWS;
+				cols = INTERMEDIATE_COLS;
+				mines = INTERMEDIATE_MINES;
 				break;	
 			case EXPERT:		
-				newGame = new MinesweeperGame(
-					EXPERT_ROWS, EXPERT_COLS, EXPERT_MINES);
+				rows = EXPERT_ROWS;
+				cols = EXPERT_COLS;
+				mines = EXPERT_MINES;
+				break;
+			case INFINITE: {
+				MinesweeperWorldGame *worldGame = 
+						new MinesweeperWorldGame(randomSeed());
+				worldGame->startGame();
+				delete(worldGame);
 				break;
+			}
 			default:
 				break;
 		}
@@ -51,14 +148,158 @@ int main()
 		if (choice == EXIT) {
 			break;
 		}
-		else {
-			newGame->startGame();
+		else if (rows > 0 && noGuess) {
+			uint64_t seed = 0;
+			if (generatorLevel != choice) {
+				delete(generator);
+				generator = new MinesweeperGenerator(rows, cols, mines, 0);
+				generator->prefetch(randomSeed());
+				generatorLevel = choice;
+			}
+			bool found = generator->takeBoard(seed);
+			generator->prefetch(randomSeed());	// ready for the next round
+
+			if (!game) {
+				game = new MinesweeperGame(rows, cols, mines);
+			}
+			if (found) {
+				game->resetNoGuess(rows, cols, mines, seed, 
+						generator->getStartRow(), generator->getStartCol());
+			}
+			else {
+				game->reset(rows, cols, mines, randomSeed());
+			}
+			game->startGame();
 		}
-		
-		if (newGame) {
-			delete(newGame);
+		else if (rows > 0) {
+			if (game) {
+				game->reset(rows, cols, mines, randomSeed());
+			}
+			else {
+				game = new MinesweeperGame(rows, cols, mines);
+			}
+			game->startGame();
 		}
 	}
 
+	delete(generator);
+	delete(game);
+	return 0;
+}
+
+/**
+* 
+* static int traceMain(int argc, char *argv[])
+* 
+* Summary: Plays as usual while recording a trace
+* 
+* Parameters:	int and char* array for the command line, starting with
+*				--trace <trace file>
+* 				
+* Returns:	    int for the exit status
+*
+* Description: The trace is written once the game and any background 
+*	threads have finished.
+*
+**/
+static int traceMain(int argc, char *argv[])
+{
+	const char *path = argv[2];
+	if (!startTrace(path, TRACE_SPANS)) {
+		fprintf(stderr, "%s could not be opened for the trace\n", path);
+		return 1;
+	}
+
+	// drop --trace <file>, keeping the program name for usage messages
+	argv[2] = argv[0];
+	int status = playMain(argc - 2, argv + 2);
+
+	if (!stopTrace()) {
+		fprintf(stderr, "trace could not be written to %s\n", path);
+		return 1;
+	}
+	return status;
+}
+
+/**
+* 
+* static int replayMain(int argc, char *argv[])
+* 
+* Summary: Replays a recorded game in the game window
+* 
+* Parameters:	int and char* array for the command line, starting with
+*				--replay <move log>
+* 				
+* Returns:	    int for the exit status
+*
+**/
+static int replayMain(int argc, char *argv[])
+{
+	double speed = 1;
+
+	if (argc != 3 && !(argc == 5 && strcmp(argv[3], "--speed") == 0)) {
+		fprintf(stderr, "usage: %s --replay <move log> [--speed <x>]\n", 
+				argv[0]);
+		return 1;
+	}
+	if (argc == 5) {
+		speed = atof(argv[4]);
+	}
+	if (speed <= 0) {
+		fprintf(stderr, "speed must be greater than 0\n");
+		return 1;
+	}
+
+	MinesweeperMoveLog log;
+	if (!log.open(argv[2])) {
+		fprintf(stderr, "%s is not a minesweeper move log\n", argv[2]);
+		return 1;
+	}
+
+	MinesweeperGame *replayGame = new MinesweeperGame(log);
+	replayGame->replayGame(speed);
+	delete(replayGame);
+	return 0;
+}
+
+/**
+* 
+* static int boardMain(int argc, char *argv[], MinesweeperGame *&game)
+* 
+* Summary: Plays a game on a board of any size
+* 
+* Parameters:	int and char* array for the command line, starting with
+*				--board <rows> <cols> <mines>
+*				MinesweeperGame pointer (reference) to play on, created if
+*				it is nullptr. The caller keeps it for the menu's rounds.
+* 				
+* Returns:	    int for the exit status
+*
+**/
+static int boardMain(int argc, char *argv[], MinesweeperGame *&game)
+{
+	if (argc != 5) {
+		fprintf(stderr, "usage: %s --board <rows> <cols> <mines>\n", 
+				argv[0]);
+		return 1;
+	}
+
+	int rows = atoi(argv[2]);
+	int cols = atoi(argv[3]);
+	int mines = atoi(argv[4]);
+	if (rows < 1 || cols < 1 || mines < 0 
+			|| ((int64_t)rows + 2) * ((int64_t)cols + 2) > INT32_MAX
+			|| mines > rows * cols) {
+		fprintf(stderr, "invalid board size\n");
+		return 1;
+	}
+
+	if (game) {
+		game->reset(rows, cols, mines, randomSeed());
+	}
+	else {
+		game = new MinesweeperGame(rows, cols, mines);
+	}
+	game->startGame();
 	return 0;
-}
\ No newline at end of file
+}
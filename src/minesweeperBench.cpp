@@ -0,0 +1,300 @@
+/*******************************************************************************
+* File:		minesweeperBench.cpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+* 
+* Description: 
+* 
+* 	This file contains code that plays a batch of minesweeper games headless
+*	with the built in solver and reports how the solver and board performed.
+*
+*	usage: minesweeper-bench [--games N] [--rows R] [--cols C] [--mines M]
+*							 [--seed S] [--threads T] [--safe-opening 0|1]
+*							 [--no-guess 0|1] [--stats <file>]
+*	       minesweeper-bench --replay <move log>
+*
+*	Games are spread across T threads (default: every core). Win rate and 
+*	guesses for a seed are the same for any number of threads. With a safe 
+*	opening, mines are placed after the first reveal and kept away from it.
+*
+*	--no-guess 1 generates N boards the solver can finish without guessing
+*	instead of playing games, and reports how many candidate boards each 
+*	one took and how long. Every board found is played again to check it.
+*
+*	--stats writes the hot path counters and timers as JSON once the run is
+*	done ("-" for stdout). They are only collected by make stats builds.
+*
+*	--replay plays a game recorded by minesweeper (minesweeper.moves) as fast
+*	as possible, and reports the move rate and whether the replay still 
+*	ends exactly as the recorded game did.
+* 
+*******************************************************************************/
+#include <cstdio>
+#include <cstdlib>		// atol, atoi
+#include <cstring>		// strcmp
+#include <chrono>
+#include <ctime>
+#include <vector>
+#include "MinesweeperBatch.hpp"
+#include "MinesweeperGenerator.hpp"
+#include "MinesweeperHistogram.hpp"
+#include "MinesweeperReplay.hpp"
+#include "minesweeperStats.hpp"
+
+using std::vector;
+
+// defaults to an expert board
+#define DEFAULT_GAMES		1000
+#define DEFAULT_ROWS		16
+#define DEFAULT_COLS		40
+#define DEFAULT_MINES		99
+
+static void printPhase(const char *, const MinesweeperHistogram &);
+static int replayLog(const char *);
+static int generateBoards(int, int, int, long, unsigned long, int);
+static int finishStats(const char *, int);
+
+int main(int argc, char *argv[])
+{
+	long games = DEFAULT_GAMES;
+	int threads = 0;
+	bool safeOpening = false;
+	bool noGuess = false;
+	int rows = DEFAULT_ROWS;
+	int cols = DEFAULT_COLS;
+	int mines = DEFAULT_MINES;
+	unsigned long seed = time(0);
+	const char *statsFile = nullptr;
+
+	for (int i = 1; i + 1 < argc; i += 2) {
+		if (strcmp(argv[i], "--replay") == 0) {
+			return replayLog(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--games") == 0) {
+			games = atol(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--rows") == 0) {
+			rows = atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--cols") == 0) {
+			cols = atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--mines") == 0) {
+			mines = atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--seed") == 0) {
+			seed = strtoul(argv[i + 1], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "--threads") == 0) {
+			threads = atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--safe-opening") == 0) {
+			safeOpening = atoi(argv[i + 1]) != 0;
+		}
+		else if (strcmp(argv[i], "--no-guess") == 0) {
+			noGuess = atoi(argv[i + 1]) != 0;
+		}
+		else if (strcmp(argv[i], "--stats") == 0) {
+			statsFile = argv[i + 1];
+		}
+		else {
+			fprintf(stderr, "unknown option: %s\n", argv[i]);
+			return 1;
+		}
+	}
+	if (games < 1 || rows < 1 || cols < 1 || mines < 0 
+			|| mines > rows * cols) {
+		fprintf(stderr, "invalid board or game count\n");
+		return 1;
+	}
+	if (noGuess) {
+		if (mines > rows * cols - 9) {
+			fprintf(stderr, "no room for the start cell to open\n");
+			return 1;
+		}
+		return finishStats(statsFile, 
+				generateBoards(rows, cols, mines, games, seed, threads));
+	}
+
+	MinesweeperBatch batch(rows, cols, mines, threads);
+	batch.setSafeOpening(safeOpening);
+	BatchResult result = batch.run(games, seed);
+
+	printf("board:            %dx%d, %d mines%s\n", rows, cols, mines, 
+			safeOpening ? " (safe opening)" : "");
+	printf("games:            %ld (seed %lu)\n", games, seed);
+	printf("win rate:         %.2f%%\n", 100.0 * result.wins / games);
+	printf("guesses per game: %.3f\n", (double)result.guesses / games);
+	printf("games per second: %.1f\n", games / result.seconds);
+	printf("\n%-10s %12s %12s %12s %12s\n", 
+			"phase (us)", "p50", "p90", "p99", "max");
+	printPhase("generate", result.generateTimes);
+	printPhase("solve", result.solveTimes);
+	printPhase("guess", result.guessTimes);
+
+	return finishStats(statsFile, 0);
+}
+
+/**
+* 
+* static int finishStats(const char *path, int status)
+* 
+* Summary: Writes the stats at the end of a run, if they were asked for
+* 
+* Parameters:	char* for the --stats file, or nullptr
+*				int for the exit status of the run
+* 
+* Returns:	    int - the exit status, or 1 if the stats couldn't be written
+* 
+**/
+static int finishStats(const char *path, int status)
+{
+	if (!path) {
+		return status;
+	}
+	if (!writeStats(path)) {
+#ifdef MINESWEEPER_STATS
+		fprintf(stderr, "couldn't write stats to %s\n", path);
+#else
+		fprintf(stderr, "stats are only collected by make stats builds\n");
+#endif
+		return 1;
+	}
+	return status;
+}
+
+/**
+* 
+* static int generateBoards(int rows, int cols, int mines, long boards, 
+*		unsigned long seed, int threads)
+* 
+* Summary: Generates boards that can be won without guessing and reports 
+*	the cost
+* 
+* Parameters:	int for board rows
+*				int for board cols
+*				int for number of mines
+*				long for the number of boards
+*				unsigned long for the seed, board n uses seed + n
+*				int for the number of worker threads, 0 to use every core
+* 				
+* Returns:	    int for the exit status, 1 if a board couldn't be found or
+*				didn't solve when played again
+*
+**/
+static int generateBoards(int rows, int cols, int mines, long boards, 
+		unsigned long seed, int threads)
+{
+	MinesweeperGenerator generator(rows, cols, mines, threads);
+	MinesweeperBoard board(rows, cols, mines, 0);
+	MinesweeperSolver solver(&board);
+	MinesweeperHistogram generateTimes;
+	long candidates = 0, solved = 0;
+	bool failed = false;
+
+	board.setSafeOpening(true);
+	solver.setParallel(false);
+	std::chrono::steady_clock::time_point start = 
+			std::chrono::steady_clock::now();
+	for (long n = 0; n < boards && !failed; n++) {
+		uint64_t boardSeed = 0;
+		std::chrono::steady_clock::time_point boardStart = 
+				std::chrono::steady_clock::now();
+		failed = !generator.generate(seed + n, boardSeed);
+		generateTimes.add(std::chrono::duration<double>(
+				std::chrono::steady_clock::now() - boardStart).count());
+		candidates += generator.getCandidates();
+
+		// play it again on a separate board to check it
+		board.reset(rows, cols, mines, boardSeed);
+		solver.reset();
+		board.revealCell(generator.getStartRow(), generator.getStartCol());
+		while (solver.solvePuzzle()) {
+		}
+		solved += board.checkGameState() == WIN;
+	}
+	double seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	if (failed) {
+		fprintf(stderr, "no board found in %ld candidates\n", 
+				MinesweeperGenerator::MAX_CANDIDATES);
+		return 1;
+	}
+
+	printf("board:                %dx%d, %d mines (no guess)\n", 
+			rows, cols, mines);
+	printf("boards:               %ld (seed %lu)\n", boards, seed);
+	printf("solved when replayed: %.2f%%\n", 100.0 * solved / boards);
+	printf("candidates per board: %.1f\n", (double)candidates / boards);
+	printf("boards per second:    %.1f\n", boards / seconds);
+	printf("\n%-10s %12s %12s %12s %12s\n", 
+			"phase (us)", "p50", "p90", "p99", "max");
+	printPhase("generate", generateTimes);
+
+	return solved == boards ? 0 : 1;
+}
+
+/**
+* 
+* static void printPhase(const char *name, const MinesweeperHistogram &times)
+* 
+* Summary: Prints latency percentiles for one phase of the games
+* 
+* Parameters:	char* for the name of the phase
+*				MinesweeperHistogram of the time spent per game
+* 				
+* Returns:	    void
+*
+**/
+static void printPhase(const char *name, const MinesweeperHistogram &times)
+{
+	printf("%-10s %12.1f %12.1f %12.1f %12.1f\n", name, 
+			times.getPercentile(0.50) * 1e6, times.getPercentile(0.90) * 1e6,
+			times.getPercentile(0.99) * 1e6, times.getMax() * 1e6);
+}
+
+/**
+* 
+* static int replayLog(const char *path)
+* 
+* Summary: Replays a recorded game headless and reports the result
+* 
+* Parameters:	char* for the move log path
+* 				
+* Returns:	    int for the exit status - 1 if the log can't be read or the
+*				replay doesn't match the recording
+*
+**/
+static int replayLog(const char *path)
+{
+	MinesweeperMoveLog log;
+	if (!log.open(path)) {
+		fprintf(stderr, "%s is not a minesweeper move log\n", path);
+		return 1;
+	}
+
+	MinesweeperBoard board(log.getRows(), log.getCols(), 0, log.getSeed());
+	MinesweeperSolver solver(&board);
+	std::chrono::steady_clock::time_point start = 
+			std::chrono::steady_clock::now();
+	MinesweeperReplay replay(&log, &board, &solver);
+	while (replay.step()) {
+	}
+	double seconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+
+	const char *states[] = {"pending", "win", "lose"};
+	printf("board:            %dx%d, %d mines%s\n", log.getRows(), 
+			log.getCols(), log.getMines(), 
+			log.getSafeOpening() ? " (safe opening)" : "");
+	printf("seed:             %llu\n", (unsigned long long)log.getSeed());
+	printf("moves:            %lu of %lu\n", 
+			(unsigned long)replay.getPosition(), 
+			(unsigned long)log.getMoveCount());
+	printf("result:           %s\n", states[replay.getGameState()]);
+	printf("moves per second: %.0f\n", replay.getPosition() / seconds);
+	printf("matches log:      %s\n", replay.matchesLog() ? "yes" 
+			: (replay.getLogEnded() ? "NO" : "no end record"));
+
+	return replay.matchesLog() ? 0 : 1;
+}
@@ -0,0 +1,306 @@
+/*******************************************************************************
+* File:		minesweeperHints.cpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description: This file contains the hint kernel for minesweeper boards.
+*	Every cell's hint is the sum of the mine plane over the 3x3 box around it,
+*	so whole rows are computed 32 (AVX2) or 16 (SSE2) cells at a time with no
+*	branches. The widest version the processor supports is picked at runtime,
+*	with a plain loop for other processors and the end of each row.
+*
+*	Both planes use the padded board layout (see MinesweeperBoard), so the
+*	box never leaves the buffer.
+*
+*******************************************************************************/
+#include "minesweeperHints.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MINESWEEPER_X86
+#include <immintrin.h>
+#endif
+
+typedef int (*HintRowFunction)(const char *, char *, int, int);
+
+static void countRows(HintRowFunction, const char *, char *, int, int, int);
+static int hintRowScalar(const char *, char *, int, int);
+static HintRowFunction selectHintRow();
+
+#ifdef MINESWEEPER_X86
+static int hintRowSse2(const char *, char *, int, int);
+static int hintRowAvx2(const char *, char *, int, int);
+#endif
+
+/**
+*
+* void countNeighborMines(const char *mines, char *board, int rows, int cols,
+*		int stride)
+*
+* Summary: Writes the hint for every playable cell of a board
+*
+* Parameters:	char array of the padded mine plane (1 for a mine, else 0)
+*				char array of the padded solution board to fill
+*				int for board rows
+*				int for board cols
+*				int for the padded row length
+*
+* Returns:	    void
+*
+* Description: Mines become '*' and every other cell becomes '0'-'8', the
+*	number of mines around it. Border cells of the board are not written.
+*
+*	0 0 0 0 0 0 0 0 0 0 				1 2 2 2 1 0 0 0 0 0
+*	1 0 1 1 0 0 0 0 0 0 				* 2 * * 1 0 0 0 0 0
+*	0 0 0 0 0 0 0 0 0 0 				2 3 2 2 1 0 0 0 0 0
+*	1 0 0 0 0 0 0 0 0 0 				* 1 0 0 0 0 0 0 0 0
+*	0 0 0 0 0 0 0 0 0 0 		->		1 1 0 0 0 0 0 0 0 0
+*
+**/
+void countNeighborMines(const char *mines, char *board, int rows, int cols,
+		int stride)
+{
+	// chosen once, the first time a board is generated
+	static const HintRowFunction hintRow = selectHintRow();
+
+	countRows(hintRow, mines, board, rows, cols, stride);
+}
+
+/**
+*
+* bool countNeighborMines(const char *mines, char *board, int rows, int cols,
+*		int stride, HintKernel kernel)
+*
+* Summary: Writes the hint for every playable cell with a chosen kernel
+*
+* Parameters:	char array of the padded mine plane (1 for a mine, else 0)
+*				char array of the padded solution board to fill
+*				int for board rows
+*				int for board cols
+*				int for the padded row length
+*				HintKernel to use instead of the fastest one
+*
+* Returns:	    bool - false (and nothing written) if this processor or 
+*				build can't run the kernel
+*
+* Description: Lets minesweeper-test compare every kernel with the scalar
+*	loop, whichever one this processor would pick.
+*
+**/
+bool countNeighborMines(const char *mines, char *board, int rows, int cols,
+		int stride, HintKernel kernel)
+{
+	HintRowFunction hintRow = nullptr;
+
+	switch (kernel) {
+		case HINT_SCALAR:
+			hintRow = hintRowScalar;
+			break;
+#ifdef MINESWEEPER_X86
+		case HINT_SSE2:
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("sse2")) {
+				hintRow = hintRowSse2;
+			}
+			break;
+		case HINT_AVX2:
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) {
+				hintRow = hintRowAvx2;
+			}
+			break;
+#endif
+		default:
+			break;
+	}
+	if (!hintRow) {
+		return false;
+	}
+	countRows(hintRow, mines, board, rows, cols, stride);
+	return true;
+}
+
+/**
+*
+* static void countRows(HintRowFunction hintRow, const char *mines,
+*		char *board, int rows, int cols, int stride)
+*
+* Summary: Runs a row kernel over every row, finishing each with the scalar
+*	loop
+*
+* Parameters:	HintRowFunction for the row kernel
+*				the rest as for countNeighborMines
+*
+* Returns:	    void
+*
+**/
+static void countRows(HintRowFunction hintRow, const char *mines,
+		char *board, int rows, int cols, int stride)
+{
+	for (int i = 0; i < rows; i++) {
+		int start = (i + 1) * stride + 1;
+		int done = hintRow(mines + start, board + start, cols, stride);
+
+		hintRowScalar(mines + start + done, board + start + done,
+				cols - done, stride);
+	}
+}
+
+/**
+*
+* static HintRowFunction selectHintRow()
+*
+* Summary: Picks the fastest row kernel this processor can run
+*
+* Parameters:	none
+*
+* Returns:	    HintRowFunction
+*
+**/
+static HintRowFunction selectHintRow()
+{
+#ifdef MINESWEEPER_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return hintRowAvx2;
+	}
+	if (__builtin_cpu_supports("sse2")) {
+		return hintRowSse2;
+	}
+#endif
+	return hintRowScalar;
+}
+
+/**
+*
+* static int hintRowScalar(const char *mines, char *board, int count,
+*		int stride)
+*
+* Summary: Writes hints for a run of cells one at a time
+*
+* Parameters:	char array of the mine plane at the first cell
+*				char array of the board at the first cell
+*				int for the number of cells
+*				int for the padded row length
+*
+* Returns:	    int for the number of cells written (all of them)
+*
+**/
+static int hintRowScalar(const char *mines, char *board, int count,
+		int stride)
+{
+	for (int j = 0; j < count; j++) {
+		const char *above = mines + j - stride;
+		const char *below = mines + j + stride;
+		int sum = above[-1] + above[0] + above[1]
+				+ mines[j - 1] + mines[j + 1]
+				+ below[-1] + below[0] + below[1];
+
+		board[j] = mines[j] ? '*' : (char)('0' + sum);
+	}
+	return count;
+}
+
+#ifdef MINESWEEPER_X86
+/**
+*
+* static int hintRowSse2(const char *mines, char *board, int count,
+*		int stride)
+*
+* Summary: Writes hints for a run of cells 16 at a time
+*
+* Parameters:	char array of the mine plane at the first cell
+*				char array of the board at the first cell
+*				int for the number of cells
+*				int for the padded row length
+*
+* Returns:	    int for the number of cells written, a multiple of 16. The
+*				rest are left for hintRowScalar.
+*
+**/
+__attribute__((target("sse2")))
+static int hintRowSse2(const char *mines, char *board, int count,
+		int stride)
+{
+	const __m128i zero = _mm_set1_epi8('0');
+	const __m128i mine = _mm_set1_epi8('*');
+	int j = 0;
+
+	for (; j + 16 <= count; j += 16) {
+		const char *cell = mines + j;
+		__m128i sum = _mm_loadu_si128((const __m128i *)(cell - stride - 1));
+		sum = _mm_add_epi8(sum,
+				_mm_loadu_si128((const __m128i *)(cell - stride)));
+		sum = _mm_add_epi8(sum,
+				_mm_loadu_si128((const __m128i *)(cell - stride + 1)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128((const __m128i *)(cell - 1)));
+		sum = _mm_add_epi8(sum, _mm_loadu_si128((const __m128i *)(cell + 1)));
+		sum = _mm_add_epi8(sum,
+				_mm_loadu_si128((const __m128i *)(cell + stride - 1)));
+		sum = _mm_add_epi8(sum,
+				_mm_loadu_si128((const __m128i *)(cell + stride)));
+		sum = _mm_add_epi8(sum,
+				_mm_loadu_si128((const __m128i *)(cell + stride + 1)));
+
+		// 0x00 or 0xff per cell, then pick '*' or the hint
+		__m128i isMine = _mm_sub_epi8(_mm_setzero_si128(),
+				_mm_loadu_si128((const __m128i *)cell));
+		__m128i hint = _mm_add_epi8(sum, zero);
+		__m128i result = _mm_or_si128(_mm_and_si128(isMine, mine),
+				_mm_andnot_si128(isMine, hint));
+		_mm_storeu_si128((__m128i *)(board + j), result);
+	}
+	return j;
+}
+
+/**
+*
+* static int hintRowAvx2(const char *mines, char *board, int count,
+*		int stride)
+*
+* Summary: Writes hints for a run of cells 32 at a time
+*
+* Parameters:	char array of the mine plane at the first cell
+*				char array of the board at the first cell
+*				int for the number of cells
+*				int for the padded row length
+*
+* Returns:	    int for the number of cells written, a multiple of 32. The
+*				rest are left for hintRowScalar.
+*
+**/
+__attribute__((target("avx2")))
+static int hintRowAvx2(const char *mines, char *board, int count,
+		int stride)
+{
+	const __m256i zero = _mm256_set1_epi8('0');
+	const __m256i mine = _mm256_set1_epi8('*');
+	int j = 0;
+
+	for (; j + 32 <= count; j += 32) {
+		const char *cell = mines + j;
+		__m256i sum = _mm256_loadu_si256((const __m256i *)(cell - stride - 1));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell - stride)));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell - stride + 1)));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell - 1)));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell + 1)));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell + stride - 1)));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell + stride)));
+		sum = _mm256_add_epi8(sum,
+				_mm256_loadu_si256((const __m256i *)(cell + stride + 1)));
+
+		__m256i isMine = _mm256_cmpgt_epi8(
+				_mm256_loadu_si256((const __m256i *)cell),
+				_mm256_setzero_si256());
+		__m256i result = _mm256_blendv_epi8(_mm256_add_epi8(sum, zero),
+				mine, isMine);
+		_mm256_storeu_si256((__m256i *)(board + j), result);
+	}
+	return j;
+}
+#endif
@@ -0,0 +1,22 @@
+/*******************************************************************************
+* File:		minesweeperHints.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*******************************************************************************/
+#ifndef MINESWEEPER_HINTS_HPP
+#define MINESWEEPER_HINTS_HPP
+
+// row kernels, named so each one can be checked against the scalar loop
+enum HintKernel
+{
+	HINT_SCALAR,
+	HINT_SSE2,
+	HINT_AVX2
+};
+
+void countNeighborMines(const char *mines, char *board, int rows, int cols,
+		int stride);
+bool countNeighborMines(const char *mines, char *board, int rows, int cols,
+		int stride, HintKernel kernel);
+
+#endif
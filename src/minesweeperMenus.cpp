@@ -49,8 +49,9 @@ MenuChoice mainMenu()
 		"1. Beginner                                           ",
 		"2. Intermediate                                       ",
 		"3. Expert                                             ",
-		"4. Help                                               ",
-		"5. Exit                                               "
+		"4. Infinite                                           ",
+		"5. Help                                               ",
+		"6. Exit                                               "
 	};
 
 	const char menuInstruction[] = "[press enter to make selection]";
@@ -63,7 +64,7 @@ MenuChoice mainMenu()
 	int gameTitleStartx = winMaxx / 2 - gameTitleWidth / 2;
 	if (gameTitleStartx < 0) {gameTitleStartx = 0;}
 	
-	int gameMenuHeight = 7;
+	int gameMenuHeight = 8;
 	int gameMenuWidth = gameTitleWidth;
 	int gameMenuStarty = gameTitleStarty + gameTitleHeight;
 	int gameMenuStartx = gameTitleStartx;
@@ -121,8 +122,8 @@ MenuChoice mainMenu()
 			case KEY_DOWN:
 			case 'j':
 				highlight += 1;
-				if (highlight == 5) {
-					highlight = 4;
+				if (highlight == 6) {
+					highlight = 5;
 				}
 				break;
 			case '1':	
@@ -134,18 +135,21 @@ MenuChoice mainMenu()
 			case '3':
 				highlight = 2;
 				break;
-			case '4':	// help
+			case '4':
 				highlight = 3;
 				break;
-			case '5':	// quit
+			case '5':	// help
 				highlight = 4;
 				break;
+			case '6':	// quit
+				highlight = 5;
+				break;
 			default:
 				break;
 		}
 
 		if (ch == 10 || ch == 'g') {	// user has pushed enter or g for go
-			if (highlight == 3) {
+			if (highlight == 4) {
 				helpMenu(gameMenuWidth, gameMenuStarty, gameMenuStartx);
 
 				// reset windows that were erased by help
@@ -158,7 +162,7 @@ MenuChoice mainMenu()
 			}
 		}
 		else if (ch == 'q') {	// user entered q for quit
-			highlight = 4;
+			highlight = 5;
 			break;
 		}
 	}	// end while(1)
@@ -6,7 +6,7 @@
 #ifndef MINESWEEPER_MENUS_HPP
 #define MINESWEEPER_MENUS_HPP
 
-enum MenuChoice {BEGINNER, INTERMEDIATE, EXPERT, HELP, EXIT};
+enum MenuChoice {BEGINNER, INTERMEDIATE, EXPERT, INFINITE, HELP, EXIT};
 
 MenuChoice mainMenu();
 void helpMenu(int, int, int);
@@ -0,0 +1,648 @@
+/*******************************************************************************
+* File:		minesweeperMicrobench.cpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description:
+*
+* 	This file contains code that times the board and solver hot paths one
+*	operation at a time and reports nanoseconds and heap allocations per
+*	operation, so they can be compared from one commit to the next.
+*
+*	usage: minesweeper-microbench [--filter F] [--min-time S] [--seed N]
+*								  [--format table|json]
+*
+*	Every benchmark runs on beginner, intermediate and expert boards and on
+*	two large boards at expert density. Only benchmarks whose name contains
+*	F are run. Each one repeats its operation until at least S seconds of it
+*	were timed. Boards are seeded from N (default 1), cycling through 8
+*	seeds, so runs on different commits time the same boards.
+*
+*	Setup (e.g. a new board before a reveal) is not timed or counted. The
+*	solver runs on one thread.
+*
+*******************************************************************************/
+#include <stddef.h>		// size_t
+#include <cstdio>
+#include <cstdlib>		// malloc, free, atof, strtoul
+#include <cstring>		// strcmp, strstr
+#include <chrono>
+#include <ctime>
+#include <new>			// bad_alloc
+#include <string>
+#include <vector>
+#include "MinesweeperBoard.hpp"
+#include "MinesweeperBoardView.hpp"
+#include "MinesweeperSolver.hpp"
+
+using std::vector;
+
+typedef std::chrono::steady_clock Clock;
+
+#define DEFAULT_MIN_TIME	0.2		// seconds timed per benchmark
+#define DEFAULT_SEED		1
+#define SEED_COUNT			8		// boards cycled through by a benchmark
+#define MAX_ITERATIONS		1000000000L
+#define MAX_WALL_FACTOR		10		// untimed setup may take 10x min time
+
+struct BenchSize
+{
+	const char *name;
+	int rows, cols, mines;
+};
+
+static const BenchSize BENCH_SIZES[] = {
+	{"beginner",		10,		10,		10},
+	{"intermediate",	16,		16,		40},
+	{"expert",			16,		40,		99},
+	{"large",			256,	256,	10000},		// expert density
+	{"huge",			1024,	1024,	160000}
+};
+
+struct BenchState
+{
+	const BenchSize *size;
+	unsigned long seed;
+	long iterations;		// operations to run
+	Clock::time_point start;
+	long startAllocations;
+	double seconds;			// timed so far
+	long allocations;		// allocated while timing so far
+};
+
+struct BenchRecord
+{
+	std::string name;
+	const BenchSize *size;
+	long iterations;
+	double nsPerOp;
+	double allocsPerOp;
+};
+
+typedef void (*BenchFunction)(BenchState &);
+
+struct Benchmark
+{
+	const char *name;
+	BenchFunction function;
+};
+
+static void benchConstruct(BenchState &);
+static void benchReset(BenchState &);
+static void benchReveal(BenchState &);
+static void benchCheckGameState(BenchState &);
+static void benchVerifyFlags(BenchState &);
+static void benchSolverPass(BenchState &);
+static void benchBoardSolvePass(BenchState &);
+static void benchAutosolve(BenchState &);
+
+static const Benchmark BENCHMARKS[] = {
+	{"construct",		benchConstruct},
+	{"reset",			benchReset},
+	{"revealCell",		benchReveal},
+	{"checkGameState",	benchCheckGameState},
+	{"verifyFlags",		benchVerifyFlags},
+	{"solvePuzzle",		benchSolverPass},
+	{"boardSolvePuzzle",	benchBoardSolvePass},
+	{"autosolve",		benchAutosolve}
+};
+
+static BenchRecord runBenchmark(const Benchmark &, const BenchSize &,
+		unsigned long, double);
+static void resumeTiming(BenchState &);
+static void pauseTiming(BenchState &);
+static unsigned long boardSeed(const BenchState &, long);
+static vector<int> findOpenings(const BenchState &);
+static void printTable(const vector<BenchRecord> &);
+static void printJson(const vector<BenchRecord> &, unsigned long, double);
+
+// heap allocations made so far, counted by the operator new below
+static long allocationCount = 0;
+static volatile long benchSink;	// keeps results of timed calls alive
+
+void *operator new(size_t size)
+{
+	allocationCount++;
+	void *ptr = malloc(size ? size : 1);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+	free(ptr);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *filter = "";
+	double minTime = DEFAULT_MIN_TIME;
+	unsigned long seed = DEFAULT_SEED;
+	bool json = false;
+
+	for (int i = 1; i < argc; i += 2) {
+		if (i + 1 >= argc) {
+			fprintf(stderr, "missing value for %s\n", argv[i]);
+			return 1;
+		}
+		else if (strcmp(argv[i], "--filter") == 0) {
+			filter = argv[i + 1];
+		}
+		else if (strcmp(argv[i], "--min-time") == 0) {
+			minTime = atof(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--seed") == 0) {
+			seed = strtoul(argv[i + 1], nullptr, 10);
+		}
+		else if (strcmp(argv[i], "--format") == 0
+				&& (strcmp(argv[i + 1], "table") == 0
+					|| strcmp(argv[i + 1], "json") == 0)) {
+			json = strcmp(argv[i + 1], "json") == 0;
+		}
+		else {
+			fprintf(stderr, "unknown option: %s %s\n", argv[i], argv[i + 1]);
+			return 1;
+		}
+	}
+	if (minTime <= 0) {
+		fprintf(stderr, "min time must be greater than 0\n");
+		return 1;
+	}
+
+	vector<BenchRecord> records;
+	for (size_t b = 0; b < sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]); b++) {
+		for (size_t s = 0; s < sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]);
+				s++) {
+			std::string name = std::string(BENCHMARKS[b].name) + "/"
+					+ BENCH_SIZES[s].name;
+			if (!strstr(name.c_str(), filter)) {
+				continue;
+			}
+			records.push_back(runBenchmark(BENCHMARKS[b], BENCH_SIZES[s],
+					seed, minTime));
+			records.back().name = name;
+			if (!json) {	// show progress as the table is built
+				printTable(vector<BenchRecord>(1, records.back()));
+			}
+		}
+	}
+
+	if (json) {
+		printJson(records, seed, minTime);
+	}
+	return 0;
+}
+
+/**
+*
+* static BenchRecord runBenchmark(const Benchmark &benchmark,
+*		const BenchSize &size, unsigned long seed, double minTime)
+*
+* Summary: Times a benchmark on one board size
+*
+* Parameters:	Benchmark to run
+*				BenchSize of the boards
+*				unsigned long for the first board seed
+*				double for the seconds that must be timed
+*
+* Returns:	    BenchRecord for the last run
+*
+* Description: Starts with one operation and keeps running with more until
+*	the timed part takes at least minTime, growing the count by up to 10x a
+*	run, the way google benchmark does. Benchmarks with slow setup (a new
+*	huge board before every reveal) stop early, once a run takes 10 times
+*	minTime, and report what was timed so far.
+*
+**/
+static BenchRecord runBenchmark(const Benchmark &benchmark,
+		const BenchSize &size, unsigned long seed, double minTime)
+{
+	BenchState state;
+	state.size = &size;
+	state.seed = seed;
+	state.iterations = 1;
+
+	while (1) {
+		state.seconds = 0;
+		state.allocations = 0;
+		Clock::time_point start = Clock::now();
+		benchmark.function(state);
+		double wall = std::chrono::duration<double>(Clock::now() - start)
+				.count();
+
+		if (state.seconds >= minTime || wall >= minTime * MAX_WALL_FACTOR
+				|| state.iterations >= MAX_ITERATIONS) {
+			break;
+		}
+		double multiplier = 10;
+		if (state.seconds > minTime / 10) {
+			multiplier = minTime * 1.4 / state.seconds;
+		}
+		if (multiplier * wall > minTime * MAX_WALL_FACTOR) {
+			multiplier = minTime * MAX_WALL_FACTOR / wall;
+		}
+		long next = (long)(state.iterations * multiplier);
+		state.iterations = next > state.iterations ? next
+				: state.iterations + 1;
+		if (state.iterations > MAX_ITERATIONS) {
+			state.iterations = MAX_ITERATIONS;
+		}
+	}
+
+	BenchRecord record;
+	record.size = &size;
+	record.iterations = state.iterations;
+	record.nsPerOp = state.seconds * 1e9 / state.iterations;
+	record.allocsPerOp = (double)state.allocations / state.iterations;
+	return record;
+}
+
+/**
+*
+* static void resumeTiming(BenchState &state)
+*
+* Summary: Starts timing and counting allocations
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void resumeTiming(BenchState &state)
+{
+	state.startAllocations = allocationCount;
+	state.start = Clock::now();
+}
+
+/**
+*
+* static void pauseTiming(BenchState &state)
+*
+* Summary: Stops timing and counting allocations
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void pauseTiming(BenchState &state)
+{
+	Clock::time_point end = Clock::now();
+	state.seconds += std::chrono::duration<double>(end - state.start).count();
+	state.allocations += allocationCount - state.startAllocations;
+}
+
+/**
+*
+* static unsigned long boardSeed(const BenchState &state, long iteration)
+*
+* Summary: Returns the seed of the board for one operation
+*
+* Parameters:	BenchState of the running benchmark
+*				long for the operation number
+*
+* Returns:	    unsigned long
+*
+**/
+static unsigned long boardSeed(const BenchState &state, long iteration)
+{
+	return state.seed + iteration % SEED_COUNT;
+}
+
+/**
+*
+* static vector<int> findOpenings(const BenchState &state)
+*
+* Summary: Finds a blank cell on each of the benchmark's boards
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    vector of int, row * cols + col of the first cell with no
+*				mine around it for each seed, or 0 if the board has none
+*
+* Description: Revealing it opens an area, so a reveal benchmark times a
+*	flood fill and not a single cell.
+*
+**/
+static vector<int> findOpenings(const BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	vector<int> openings(SEED_COUNT, 0);
+
+	for (int s = 0; s < SEED_COUNT; s++) {
+		MinesweeperBoard probe(size.rows, size.cols, size.mines,
+				boardSeed(state, s));
+		probe.revealMines();
+		MinesweeperBoardView view = probe.getView();
+
+		bool found = false;
+		for (int i = 0; i < size.rows && !found; i++) {
+			for (int j = 0; j < size.cols && !found; j++) {
+				found = true;
+				for (int r = i - 1; r <= i + 1; r++) {
+					for (int c = j - 1; c <= j + 1; c++) {
+						if (probe.isInBounds(r, c) && view(r, c) == '*') {
+							found = false;
+						}
+					}
+				}
+				if (found) {
+					openings[s] = i * size.cols + j;
+				}
+			}
+		}
+	}
+	return openings;
+}
+
+/**
+*
+* static void benchConstruct(BenchState &state)
+*
+* Summary: Times creating a board, which places the mines and sets hints
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchConstruct(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+
+	for (long i = 0; i < state.iterations; i++) {
+		resumeTiming(state);
+		MinesweeperBoard *board = new MinesweeperBoard(size.rows, size.cols,
+				size.mines, boardSeed(state, i));
+		pauseTiming(state);
+		delete(board);
+	}
+}
+
+/**
+*
+* static void benchReset(BenchState &state)
+*
+* Summary: Times starting a new game on an existing board, which places the
+*	mines and sets hints without new memory
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchReset(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+
+	for (long i = 0; i < state.iterations; i++) {
+		resumeTiming(state);
+		board.reset(size.rows, size.cols, size.mines, boardSeed(state, i));
+		pauseTiming(state);
+	}
+}
+
+/**
+*
+* static void benchReveal(BenchState &state)
+*
+* Summary: Times the first reveal of a new board, a flood fill
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchReveal(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+	vector<int> openings = findOpenings(state);
+
+	for (long i = 0; i < state.iterations; i++) {
+		int cell = openings[i % SEED_COUNT];
+		board.reset(size.rows, size.cols, size.mines, boardSeed(state, i));
+		resumeTiming(state);
+		benchSink = board.revealCell(cell / size.cols, cell % size.cols)
+				.size();
+		pauseTiming(state);
+	}
+}
+
+/**
+*
+* static void benchCheckGameState(BenchState &state)
+*
+* Summary: Times checking the game state of a game in progress
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchCheckGameState(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+	int cell = findOpenings(state)[0];
+	board.revealCell(cell / size.cols, cell % size.cols);
+
+	long pending = 0;
+	resumeTiming(state);
+	for (long i = 0; i < state.iterations; i++) {
+		pending += board.checkGameState() == PENDING;
+	}
+	pauseTiming(state);
+	benchSink = pending;
+}
+
+/**
+*
+* static void benchVerifyFlags(BenchState &state)
+*
+* Summary: Times verifying the flags of a game the solver is stuck on
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchVerifyFlags(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+	MinesweeperSolver solver(&board);
+	solver.setParallel(false);
+	int cell = findOpenings(state)[0];
+	board.revealCell(cell / size.cols, cell % size.cols);
+	while (board.checkGameState() == PENDING && solver.solvePuzzle()) {
+	}
+
+	long valid = 0;
+	resumeTiming(state);
+	for (long i = 0; i < state.iterations; i++) {
+		valid += board.verifyFlags();
+	}
+	pauseTiming(state);
+	benchSink = valid;
+}
+
+/**
+*
+* static void benchSolverPass(BenchState &state)
+*
+* Summary: Times one MinesweeperSolver::solvePuzzle call after the first
+*	reveal of a new board
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchSolverPass(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+	MinesweeperSolver solver(&board);
+	solver.setParallel(false);
+	vector<int> openings = findOpenings(state);
+
+	for (long i = 0; i < state.iterations; i++) {
+		int cell = openings[i % SEED_COUNT];
+		board.reset(size.rows, size.cols, size.mines, boardSeed(state, i));
+		solver.reset();
+		board.revealCell(cell / size.cols, cell % size.cols);
+		resumeTiming(state);
+		benchSink = solver.solvePuzzle();
+		pauseTiming(state);
+	}
+}
+
+/**
+*
+* static void benchBoardSolvePass(BenchState &state)
+*
+* Summary: Times one MinesweeperBoard::solvePuzzle call (a full board scan)
+*	after the first reveal of a new board
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchBoardSolvePass(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+	vector<int> openings = findOpenings(state);
+
+	for (long i = 0; i < state.iterations; i++) {
+		int cell = openings[i % SEED_COUNT];
+		board.reset(size.rows, size.cols, size.mines, boardSeed(state, i));
+		board.revealCell(cell / size.cols, cell % size.cols);
+		resumeTiming(state);
+		benchSink = board.solvePuzzle();
+		pauseTiming(state);
+	}
+}
+
+/**
+*
+* static void benchAutosolve(BenchState &state)
+*
+* Summary: Times playing a new board to the end with the solver, the same
+*	way as the [s] command
+*
+* Parameters:	BenchState of the running benchmark
+*
+* Returns:	    void
+*
+**/
+static void benchAutosolve(BenchState &state)
+{
+	const BenchSize &size = *state.size;
+	MinesweeperBoard board(size.rows, size.cols, size.mines, state.seed);
+	MinesweeperSolver solver(&board);
+	solver.setParallel(false);
+
+	for (long i = 0; i < state.iterations; i++) {
+		board.reset(size.rows, size.cols, size.mines, boardSeed(state, i));
+		solver.reset();
+		resumeTiming(state);
+		while (board.checkGameState() == PENDING) {
+			if (!solver.solvePuzzle()) {
+				solver.makeGuess();
+			}
+		}
+		pauseTiming(state);
+	}
+}
+
+/**
+*
+* static void printTable(const vector<BenchRecord> &records)
+*
+* Summary: Prints results as a table
+*
+* Parameters:	vector of BenchRecord to print
+*
+* Returns:	    void
+*
+**/
+static void printTable(const vector<BenchRecord> &records)
+{
+	for (size_t i = 0; i < records.size(); i++) {
+		printf("%-32s %12ld %16.1f ns/op %10.2f allocs/op\n",
+				records[i].name.c_str(), records[i].iterations,
+				records[i].nsPerOp, records[i].allocsPerOp);
+	}
+	fflush(stdout);
+}
+
+/**
+*
+* static void printJson(const vector<BenchRecord> &records,
+*		unsigned long seed, double minTime)
+*
+* Summary: Prints results as JSON, laid out like google benchmark's output
+*
+* Parameters:	vector of BenchRecord to print
+*				unsigned long for the first board seed
+*				double for the seconds timed per benchmark
+*
+* Returns:	    void
+*
+**/
+static void printJson(const vector<BenchRecord> &records, unsigned long seed,
+		double minTime)
+{
+	char date[32];
+	time_t now = time(0);
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+
+	printf("{\n");
+	printf("  \"context\": {\n");
+	printf("    \"date\": \"%s\",\n", date);
+	printf("    \"executable\": \"minesweeper-microbench\",\n");
+	printf("    \"seed\": %lu,\n", seed);
+	printf("    \"seed_count\": %d,\n", SEED_COUNT);
+	printf("    \"min_time\": %g\n", minTime);
+	printf("  },\n");
+	printf("  \"benchmarks\": [");
+	for (size_t i = 0; i < records.size(); i++) {
+		const BenchRecord &record = records[i];
+		printf("%s\n    {\n", i ? "," : "");
+		printf("      \"name\": \"%s\",\n", record.name.c_str());
+		printf("      \"rows\": %d,\n", record.size->rows);
+		printf("      \"cols\": %d,\n", record.size->cols);
+		printf("      \"mines\": %d,\n", record.size->mines);
+		printf("      \"iterations\": %ld,\n", record.iterations);
+		printf("      \"ns_per_op\": %.3f,\n", record.nsPerOp);
+		printf("      \"allocs_per_op\": %.3f\n", record.allocsPerOp);
+		printf("    }");
+	}
+	printf("\n  ]\n}\n");
+}
@@ -0,0 +1,43 @@
+/*******************************************************************************
+* File:		minesweeperNeighbors.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description: Neighbor loops specialized on the row length of the padded
+*	boards. With STRIDE known at compile time every offset is a constant and
+*	the eight neighbors are written out, so there is no offset table to load
+*	and no loop. STRIDE 0 is the fallback for any other board size and uses
+*	the stride passed in at run time.
+*
+*	Callers compile their hot loop once per preset and pick one with a switch
+*	on the board's stride (see MinesweeperBoard::revealIndex), so the switch
+*	runs once per call rather than once per cell.
+*
+*******************************************************************************/
+#ifndef MINESWEEPER_NEIGHBORS_HPP
+#define MINESWEEPER_NEIGHBORS_HPP
+
+// padded row lengths (cols + 2) of the beginner, intermediate and expert
+// presets in minesweeper.cpp
+static const int BEGINNER_STRIDE = 12;
+static const int INTERMEDIATE_STRIDE = 18;
+static const int EXPERT_STRIDE = 42;
+
+// calls visit(neighbor) for the padded board index of each neighbor of idx,
+// in the same order as MinesweeperBoard::setNeighborCellOffsets
+template <int STRIDE, typename Visit>
+inline void forEachNeighbor(int idx, int stride, Visit visit)
+{
+	const int s = STRIDE ? STRIDE : stride;
+
+	visit(idx - s - 1);		// up left
+	visit(idx - s);			// up
+	visit(idx - s + 1);		// up right
+	visit(idx - 1);			// left
+	visit(idx + 1);			// right
+	visit(idx + s - 1);		// down left
+	visit(idx + s);			// down
+	visit(idx + s + 1);		// down right
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*******************************************************************************
+* File:		minesweeperStats.cpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description: Keeps track of every thread's counter block and writes the
+*	totals as JSON. Only compiled into stats builds (-DMINESWEEPER_STATS).
+*
+*******************************************************************************/
+#include "minesweeperStats.hpp"
+
+#ifdef MINESWEEPER_STATS
+
+#include <algorithm>	// find, max
+#include <cinttypes>	// PRIu64
+#include <cstdio>
+#include <cstring>		// strcmp
+#include <mutex>
+#include <vector>
+
+using std::vector;
+
+// JSON names, in enum order
+static const char *COUNTER_NAMES[STAT_COUNTER_COUNT] = {
+	"cells_opened", "flood_fills", "flood_depth", "flood_depth_max",
+	"solve_passes", "single_rule_hits", "pair_rule_hits", "solver_moves",
+	"guesses", "game_state_checks", "cells_written", "keys_handled"
+};
+static const char *TIMER_NAMES[STAT_TIMER_COUNT] = {
+	"reveal", "solve", "guess", "draw", "input"
+};
+
+// blocks of running threads, and the totals of threads that have exited.
+// The lock is only taken when a thread starts or exits and by writeStats.
+static std::mutex registryLock;
+static vector<MinesweeperStatsBlock *> liveBlocks;
+static uint64_t exitedCounters[STAT_COUNTER_COUNT];
+static uint64_t exitedTimerCalls[STAT_TIMER_COUNT];
+static uint64_t exitedTimerNanos[STAT_TIMER_COUNT];
+static uint64_t exitedTimerMaxNanos[STAT_TIMER_COUNT];
+
+/**
+*
+* MinesweeperStatsBlock::MinesweeperStatsBlock()
+*
+* Summary: Constructor. Zeroes the block and registers it for writeStats
+*
+* Description: Runs the first time a thread counts something.
+*
+**/
+MinesweeperStatsBlock::MinesweeperStatsBlock()
+{
+	for (int i = 0; i < STAT_COUNTER_COUNT; i++) {
+		counters[i].store(0);
+	}
+	for (int i = 0; i < STAT_TIMER_COUNT; i++) {
+		timerCalls[i].store(0);
+		timerNanos[i].store(0);
+		timerMaxNanos[i].store(0);
+	}
+
+	std::lock_guard<std::mutex> guard(registryLock);
+	liveBlocks.push_back(this);
+}
+
+/**
+*
+* MinesweeperStatsBlock::~MinesweeperStatsBlock()
+*
+* Summary: Destructor. Adds the block to the exited totals
+*
+* Description: Runs when the thread exits.
+*
+**/
+MinesweeperStatsBlock::~MinesweeperStatsBlock()
+{
+	std::lock_guard<std::mutex> guard(registryLock);
+
+	for (int i = 0; i < STAT_COUNTER_COUNT; i++) {
+		if (i == FLOOD_DEPTH_MAX) {
+			exitedCounters[i] = std::max(exitedCounters[i],
+					(uint64_t)counters[i].load());
+		}
+		else {
+			exitedCounters[i] += counters[i].load();
+		}
+	}
+	for (int i = 0; i < STAT_TIMER_COUNT; i++) {
+		exitedTimerCalls[i] += timerCalls[i].load();
+		exitedTimerNanos[i] += timerNanos[i].load();
+		exitedTimerMaxNanos[i] = std::max(exitedTimerMaxNanos[i],
+				(uint64_t)timerMaxNanos[i].load());
+	}
+	liveBlocks.erase(std::find(liveBlocks.begin(), liveBlocks.end(), this));
+}
+
+/**
+*
+* bool writeStats(const char *path)
+*
+* Summary: Writes the counters and timers of every thread as JSON
+*
+* Parameters:	char* for the file to write, or "-" for stdout
+*
+* Returns:	    bool - false if the file couldn't be written
+*
+* Description: Totals cover every thread since the program started,
+*	including threads that are still running. Counts from a running thread
+*	may be a moment behind.
+*
+*	{"counters": {"cells_opened": 120, ...},
+*	 "timers": {"reveal": {"calls": 9, "total_ns": 5120, "max_ns": 1400},
+*	 ...}}
+*
+**/
+bool writeStats(const char *path)
+{
+	uint64_t counters[STAT_COUNTER_COUNT];
+	uint64_t calls[STAT_TIMER_COUNT], nanos[STAT_TIMER_COUNT];
+	uint64_t maxNanos[STAT_TIMER_COUNT];
+
+	{
+		std::lock_guard<std::mutex> guard(registryLock);
+
+		std::copy(exitedCounters, exitedCounters + STAT_COUNTER_COUNT,
+				counters);
+		std::copy(exitedTimerCalls, exitedTimerCalls + STAT_TIMER_COUNT,
+				calls);
+		std::copy(exitedTimerNanos, exitedTimerNanos + STAT_TIMER_COUNT,
+				nanos);
+		std::copy(exitedTimerMaxNanos,
+				exitedTimerMaxNanos + STAT_TIMER_COUNT, maxNanos);
+		for (size_t b = 0; b < liveBlocks.size(); b++) {
+			MinesweeperStatsBlock *block = liveBlocks[b];
+			for (int i = 0; i < STAT_COUNTER_COUNT; i++) {
+				uint64_t value = block->counters[i].load(
+						std::memory_order_relaxed);
+				counters[i] = (i == FLOOD_DEPTH_MAX)
+						? std::max(counters[i], value) : counters[i] + value;
+			}
+			for (int i = 0; i < STAT_TIMER_COUNT; i++) {
+				calls[i] += block->timerCalls[i].load(
+						std::memory_order_relaxed);
+				nanos[i] += block->timerNanos[i].load(
+						std::memory_order_relaxed);
+				maxNanos[i] = std::max(maxNanos[i], (uint64_t)
+						block->timerMaxNanos[i].load(
+						std::memory_order_relaxed));
+			}
+		}
+	}
+
+	bool toStdout = strcmp(path, "-") == 0;
+	FILE *file = toStdout ? stdout : fopen(path, "w");
+	if (!file) {
+		return false;
+	}
+
+	fprintf(file, "{\n  \"counters\": {\n");
+	for (int i = 0; i < STAT_COUNTER_COUNT; i++) {
+		fprintf(file, "    \"%s\": %" PRIu64 "%s\n", COUNTER_NAMES[i],
+				counters[i], i + 1 < STAT_COUNTER_COUNT ? "," : "");
+	}
+	fprintf(file, "  },\n  \"timers\": {\n");
+	for (int i = 0; i < STAT_TIMER_COUNT; i++) {
+		fprintf(file, "    \"%s\": {\"calls\": %" PRIu64 ", \"total_ns\": %"
+				PRIu64 ", \"max_ns\": %" PRIu64 "}%s\n", TIMER_NAMES[i],
+				calls[i], nanos[i], maxNanos[i],
+				i + 1 < STAT_TIMER_COUNT ? "," : "");
+	}
+	fprintf(file, "  }\n}\n");
+
+	if (toStdout) {
+		return fflush(file) == 0;
+	}
+	return fclose(file) == 0;
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* File:		minesweeperStats.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description: Event counters and scoped timers for the hot paths. They are
+*	only compiled into stats builds (-DMINESWEEPER_STATS, see make stats);
+*	in every other build the STATS_ macros expand to nothing and writeStats
+*	does nothing.
+*
+*	Every thread counts into its own block, so counting never takes a lock
+*	or a locked instruction. The slots are atomics written with relaxed
+*	loads and stores, which compile to plain adds but let writeStats read
+*	another thread's block while it runs. A block is added to the totals
+*	when its thread exits.
+*
+*******************************************************************************/
+#ifndef MINESWEEPER_STATS_HPP
+#define MINESWEEPER_STATS_HPP
+
+#include <cstdint>
+
+// counted events, named in writeStats
+enum StatCounter
+{
+	CELLS_OPENED,			// cells uncovered by reveals
+	FLOOD_FILLS,			// reveals that spread from a blank cell
+	FLOOD_DEPTH,			// breadth first levels, summed over flood fills
+	FLOOD_DEPTH_MAX,		// deepest flood fill
+	SOLVE_PASSES,			// MinesweeperSolver::solvePuzzle calls
+	SINGLE_RULE_HITS,		// single cell rules that made a move
+	PAIR_RULE_HITS,			// pair rules that made a move
+	SOLVER_MOVES,			// cells flagged or revealed by the rules
+	GUESSES,
+	GAME_STATE_CHECKS,		// MinesweeperBoard::checkGameState calls
+	CELLS_WRITTEN,			// board cells drawn with ncurses
+	KEYS_HANDLED,
+	STAT_COUNTER_COUNT
+};
+
+// timed scopes, each keeps calls, total and max time
+enum StatTimer
+{
+	REVEAL_TIMER,			// MinesweeperBoard::revealCell
+	SOLVE_TIMER,			// MinesweeperSolver::solvePuzzle
+	GUESS_TIMER,			// MinesweeperSolver::makeGuess
+	DRAW_TIMER,				// MinesweeperDisplay::printBoardChanges
+	INPUT_TIMER,			// handleKey in both games
+	STAT_TIMER_COUNT
+};
+
+#ifdef MINESWEEPER_STATS
+
+#include <atomic>
+#include <chrono>
+
+struct MinesweeperStatsBlock
+{
+	std::atomic<uint64_t> counters[STAT_COUNTER_COUNT];
+	std::atomic<uint64_t> timerCalls[STAT_TIMER_COUNT];
+	std::atomic<uint64_t> timerNanos[STAT_TIMER_COUNT];
+	std::atomic<uint64_t> timerMaxNanos[STAT_TIMER_COUNT];
+
+	MinesweeperStatsBlock();
+	~MinesweeperStatsBlock();
+};
+
+class MinesweeperStatsTimer
+{
+	public:
+		MinesweeperStatsTimer(StatTimer);
+		~MinesweeperStatsTimer();
+
+	private:
+		StatTimer timer;
+		std::chrono::steady_clock::time_point start;
+};
+
+// the calling thread's block, registered on first use
+inline MinesweeperStatsBlock &threadStats()
+{
+	static thread_local MinesweeperStatsBlock block;
+	return block;
+}
+
+// only the owning thread writes a slot, so load and store is enough
+inline void statsAdd(std::atomic<uint64_t> &slot, uint64_t n)
+{
+	slot.store(slot.load(std::memory_order_relaxed) + n,
+			std::memory_order_relaxed);
+}
+
+inline void statsMax(std::atomic<uint64_t> &slot, uint64_t n)
+{
+	if (n > slot.load(std::memory_order_relaxed)) {
+		slot.store(n, std::memory_order_relaxed);
+	}
+}
+
+inline MinesweeperStatsTimer::MinesweeperStatsTimer(StatTimer timer)
+{
+	this->timer = timer;
+	start = std::chrono::steady_clock::now();
+}
+
+inline MinesweeperStatsTimer::~MinesweeperStatsTimer()
+{
+	uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now() - start).count();
+	MinesweeperStatsBlock &block = threadStats();
+
+	statsAdd(block.timerCalls[timer], 1);
+	statsAdd(block.timerNanos[timer], nanos);
+	statsMax(block.timerMaxNanos[timer], nanos);
+}
+
+#define STATS_ADD(counter, n)	statsAdd(threadStats().counters[counter], (n))
+#define STATS_MAX(counter, n)	statsMax(threadStats().counters[counter], (n))
+#define STATS_TIMER(timer)		MinesweeperStatsTimer statsTimer(timer)
+
+bool writeStats(const char *);
+
+#else
+
+#define STATS_ADD(counter, n)
+#define STATS_MAX(counter, n)
+#define STATS_TIMER(timer)
+
+// stats aren't collected, so there is nothing to write
+inline bool writeStats(const char *)
+{
+	return false;
+}
+
+#endif
+
+#endif
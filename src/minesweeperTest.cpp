@@ -0,0 +1,374 @@
+/*******************************************************************************
+* File:		minesweeperTest.cpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description:
+*
+* 	This file contains checks that compare the fast paths with the plain
+*	versions they replace. Run them with make test.
+*
+*	usage: minesweeper-test
+*
+*	Prints one line per check and exits with 1 if any check failed.
+*
+*	hints:	every hint kernel this processor can run (scalar, SSE2, AVX2)
+*			writes exactly the same board as the scalar loop, on random
+*			mine planes of widths that end inside and on the edge of a
+*			vector.
+*
+*	solver:	on expert boards, solving until stuck, clearing the flags and
+*			solving again ends with the same flags as the first solve.
+*			Games played with guesses end the same whether the guesses
+*			are worked out on the solver's worker pool or on one thread.
+*
+*	saves:	a saved game that was changed and given a correct checksum
+*			again is refused by restore when it breaks the board's layout.
+*
+*******************************************************************************/
+#include <stddef.h>		// size_t
+#include <cstdio>
+#include <vector>
+#include "MinesweeperBoard.hpp"
+#include "MinesweeperRandom.hpp"
+#include "MinesweeperSnapshot.hpp"
+#include "MinesweeperSolver.hpp"
+#include "minesweeperHints.hpp"
+
+using std::vector;
+
+#define TEST_SEED		1
+#define SOLVER_BOARDS	500
+#define GUESS_GAMES		40
+#define GUESS_ROWS		64		// expert density
+#define GUESS_COLS		64
+#define GUESS_MINES		800
+#define SAVE_PATH		"minesweeper-test.save"
+
+// the snapshot header is 5 words of fields, the random state and then the
+// checksum of everything before it and the three bitboards
+#define SAVE_HEADER_WORDS	(5 + MinesweeperRandom::STATE_WORDS)
+
+static bool testHints();
+static bool testSolverFlags();
+static bool testParallelGuesses();
+static bool testSnapshots();
+static bool writeSave(vector<uint64_t> &);
+static uint64_t playGame(MinesweeperBoard &, MinesweeperSolver &, uint64_t);
+
+int main()
+{
+	bool passed = true;
+
+	passed &= testHints();
+	passed &= testSolverFlags();
+	passed &= testParallelGuesses();
+	passed &= testSnapshots();
+
+	printf("%s\n", passed ? "all checks passed" : "FAILED");
+	return passed ? 0 : 1;
+}
+
+/**
+*
+* static bool testHints()
+*
+* Summary: Checks the SSE2 and AVX2 hint kernels against the scalar loop
+*
+* Parameters:	none
+*
+* Returns:	    bool - true if every board matched
+*
+* Description: Boards are filled with a marker first, so writing a border
+*	cell or skipping a playable one shows up too. Mine density runs from
+*	empty to full. Kernels the processor can't run are reported as skipped.
+*
+**/
+static bool testHints()
+{
+	static const int WIDTHS[] = {1, 15, 16, 17, 31, 33, 40, 1000};
+	static const int HEIGHTS[] = {1, 3, 16};
+	static const int DENSITIES[] = {0, 10, 20, 50, 100};	// percent
+	static const HintKernel KERNELS[] = {HINT_SSE2, HINT_AVX2};
+	static const char *KERNEL_NAMES[] = {"sse2", "avx2"};
+	static const int KERNEL_COUNT = 2;
+
+	MinesweeperRandom random(TEST_SEED);
+	bool passed = true;
+
+	for (int k = 0; k < KERNEL_COUNT; k++) {
+		char probe[9] = {0}, probeBoard[9];
+		if (!countNeighborMines(probe, probeBoard, 1, 1, 3, KERNELS[k])) {
+			printf("hints %s: skipped, not supported here\n", 
+					KERNEL_NAMES[k]);
+			continue;
+		}
+
+		int boards = 0, mismatches = 0;
+		for (size_t w = 0; w < sizeof(WIDTHS) / sizeof(int); w++) {
+			for (size_t h = 0; h < sizeof(HEIGHTS) / sizeof(int); h++) {
+				for (size_t d = 0; d < sizeof(DENSITIES) / sizeof(int); d++) {
+					int rows = HEIGHTS[h], cols = WIDTHS[w];
+					int stride = cols + 2;
+
+					vector<char> mines((rows + 2) * stride, 0);
+					for (int i = 1; i <= rows; i++) {
+						for (int j = 1; j <= cols; j++) {
+							mines[i * stride + j] =
+									random.range(0, 99) < DENSITIES[d];
+						}
+					}
+
+					vector<char> expected(mines.size(), '#');
+					vector<char> actual(mines.size(), '#');
+					countNeighborMines(mines.data(), expected.data(), rows, 
+							cols, stride, HINT_SCALAR);
+					countNeighborMines(mines.data(), actual.data(), rows, 
+							cols, stride, KERNELS[k]);
+
+					boards++;
+					if (actual != expected) {
+						mismatches++;
+						printf("hints %s: %dx%d board at %d%% mines differs\n",
+								KERNEL_NAMES[k], rows, cols, DENSITIES[d]);
+					}
+				}
+			}
+		}
+
+		printf("hints %s: %d boards, %d differ\n", KERNEL_NAMES[k], boards,
+				mismatches);
+		passed &= mismatches == 0;
+	}
+	return passed;
+}
+
+/**
+*
+* static bool testSolverFlags()
+*
+* Summary: Checks that the solver finds its flags again after they are
+*	cleared
+*
+* Parameters:	none
+*
+* Returns:	    bool - true if every board ended the same both times
+*
+* Description: Clearing the flags is a change the solver didn't make, so
+*	it has to look again at every hint next to a cell that was flagged,
+*	including hints it had finished with. Boards start from a safe
+*	opening in the middle and are solved with certain moves only.
+*
+**/
+static bool testSolverFlags()
+{
+	MinesweeperBoard board(16, 40, 99, 0);
+	board.setSafeOpening(true);
+	MinesweeperSolver solver(&board);
+	solver.setParallel(false);
+	int mismatches = 0;
+
+	for (int b = 0; b < SOLVER_BOARDS; b++) {
+		board.reset(16, 40, 99, TEST_SEED + b);
+		solver.reset();
+		board.revealCell(8, 20);
+		while (solver.solvePuzzle()) {
+		}
+		int flags = board.getFlagsRemaining();
+		uint64_t hash = board.getPlayerHash();
+
+		board.clearFlags();
+		while (solver.solvePuzzle()) {
+		}
+		if (board.getFlagsRemaining() != flags 
+				|| board.getPlayerHash() != hash) {
+			mismatches++;
+			printf("solver: board %d had %d flags left, then %d after "
+					"clearing them\n", TEST_SEED + b, flags, 
+					board.getFlagsRemaining());
+		}
+	}
+
+	printf("solver: %d boards, %d lost flags\n", SOLVER_BOARDS, mismatches);
+	return mismatches == 0;
+}
+
+/**
+*
+* static bool testParallelGuesses()
+*
+* Summary: Checks that guesses don't depend on the solver's worker pool
+*
+* Parameters:	none
+*
+* Returns:	    bool - true if every game ended on the same board
+*
+* Description: Boards are big enough that most guesses have enough edge
+*	cells to go to the pool. The same solver plays every
+*	parallel game, so the pool is reused from one guess to the next.
+*
+**/
+static bool testParallelGuesses()
+{
+	MinesweeperBoard board(GUESS_ROWS, GUESS_COLS, GUESS_MINES, 0);
+	MinesweeperSolver parallelSolver(&board);
+	MinesweeperSolver serialSolver(&board);
+	serialSolver.setParallel(false);
+	int mismatches = 0;
+
+	for (int g = 0; g < GUESS_GAMES; g++) {
+		uint64_t seed = TEST_SEED + g;
+		if (playGame(board, parallelSolver, seed) 
+				!= playGame(board, serialSolver, seed)) {
+			mismatches++;
+			printf("guesses: game %d ended differently on the pool\n",
+					(int)seed);
+		}
+	}
+
+	printf("guesses: %d games, %d differ\n", GUESS_GAMES, mismatches);
+	return mismatches == 0;
+}
+
+/**
+*
+* static uint64_t playGame(MinesweeperBoard &board, MinesweeperSolver &solver,
+*		uint64_t seed)
+*
+* Summary: Plays a game to the end with the solver, guessing when stuck
+*
+* Parameters:	MinesweeperBoard to reset and play on
+*				MinesweeperSolver for the board
+*				uint64_t for the board seed
+*
+* Returns:	    uint64_t - hash of the player board at the end
+*
+**/
+static uint64_t playGame(MinesweeperBoard &board, MinesweeperSolver &solver,
+		uint64_t seed)
+{
+	board.reset(GUESS_ROWS, GUESS_COLS, GUESS_MINES, seed);
+	solver.reset();
+	while (board.checkGameState() == PENDING) {
+		if (!solver.solvePuzzle()) {
+			solver.makeGuess();
+		}
+	}
+	return board.getPlayerHash();
+}
+
+/**
+*
+* static bool testSnapshots()
+*
+* Summary: Checks that restore refuses saves that break the board's layout
+*
+* Parameters:	none
+*
+* Returns:	    bool - true if every tampered save was refused and left the
+*				board alone
+*
+* Description: Each save is an expert game in progress with one change made
+*	to its bitboards and the checksum worked out again, so open and verify
+*	accept it. The changes are the ones that would send the flood fill off
+*	the board or miscount it: no revealed cells (border included), a mine 
+*	or flag on the border, a bit past the last cell and a missing mine.
+*
+**/
+static bool testSnapshots()
+{
+	MinesweeperBoard board(16, 40, 99, TEST_SEED);
+	board.setSafeOpening(true);
+	board.revealCell(8, 20);
+	uint64_t hash = board.getPlayerHash();
+
+	MinesweeperSnapshot snapshot;
+	if (!MinesweeperSnapshot::save(board, SAVE_PATH) 
+			|| !snapshot.open(SAVE_PATH)) {
+		printf("saves: couldn't save a game\n");
+		return false;
+	}
+	int wordCount = snapshot.getWordCount();
+	const uint64_t *fileWords = snapshot.getMineWords() - SAVE_HEADER_WORDS - 1;
+	vector<uint64_t> saved(fileWords, 
+			fileWords + SAVE_HEADER_WORDS + 1 + 3 * wordCount);
+	snapshot.close();
+
+	int mineWords = SAVE_HEADER_WORDS + 1;
+	int revealedWords = mineWords + wordCount;
+	int flaggedWords = revealedWords + wordCount;
+	int pastEnd = (16 + 2) * (40 + 2);		// first bit after the last cell
+	int firstMine = 0;
+	while (!((saved[mineWords + firstMine / 64] >> (firstMine % 64)) & 1)) {
+		firstMine++;
+	}
+	uint64_t firstMineBit = (uint64_t)1 << (firstMine % 64);
+
+	vector<vector<uint64_t>> tampered(5, saved);
+	for (int i = 0; i < wordCount; i++) {
+		tampered[0][revealedWords + i] = 0;		// nothing revealed
+	}
+	tampered[1][mineWords] |= 1;			// a mine moved onto the border
+	tampered[1][mineWords + firstMine / 64] &= ~firstMineBit;
+	tampered[2][flaggedWords] |= 1;			// a flag on the border
+	tampered[3][mineWords + pastEnd / 64] |= (uint64_t)1 << (pastEnd % 64);
+	tampered[4][mineWords + firstMine / 64] &= ~firstMineBit;	// 98 mines
+
+	bool passed = writeSave(saved) && snapshot.open(SAVE_PATH) 
+			&& board.restore(snapshot) && board.getPlayerHash() == hash;
+	if (!passed) {
+		printf("saves: an untouched save didn't restore\n");
+	}
+	int refused = 0;
+	for (size_t t = 0; t < tampered.size(); t++) {
+		if (!writeSave(tampered[t]) || !snapshot.open(SAVE_PATH) 
+				|| !snapshot.verify()) {
+			printf("saves: tampered save %d failed its checksum\n", (int)t);
+		}
+		else if (board.restore(snapshot) || board.getPlayerHash() != hash) {
+			printf("saves: tampered save %d was restored\n", (int)t);
+		}
+		else {
+			refused++;
+		}
+	}
+	snapshot.close();
+
+	remove(SAVE_PATH);
+	printf("saves: %d tampered saves, %d refused\n", (int)tampered.size(), 
+			refused);
+	return passed && refused == (int)tampered.size();
+}
+
+/**
+*
+* static bool writeSave(vector<uint64_t> &words)
+*
+* Summary: Writes a save file with a correct checksum
+*
+* Parameters:	vector of the file's words, its checksum is filled in
+*
+* Returns:	    bool - false if the file couldn't be written
+*
+* Description: Works the checksum out the same way as MinesweeperSnapshot,
+*	FNV-1a taken a word at a time with the high half folded in.
+*
+**/
+static bool writeSave(vector<uint64_t> &words)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (size_t i = 0; i < words.size(); i++) {
+		if (i != SAVE_HEADER_WORDS) {
+			hash = (hash ^ words[i]) * 0x100000001b3ULL;
+			hash ^= hash >> 32;
+		}
+	}
+	words[SAVE_HEADER_WORDS] = hash;
+
+	FILE *file = fopen(SAVE_PATH, "wb");
+	if (!file) {
+		return false;
+	}
+	size_t written = fwrite(words.data(), sizeof(uint64_t), words.size(), file);
+	return fclose(file) == 0 && written == words.size();
+}
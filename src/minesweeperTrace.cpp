@@ -0,0 +1,195 @@
+/*******************************************************************************
+* File:		minesweeperTrace.cpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description: Keeps the ring buffer of trace spans and writes it as a
+*	Chrome trace event file.
+*
+*******************************************************************************/
+#include <cinttypes>	// PRIu64
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "minesweeperTrace.hpp"
+
+using std::vector;
+
+typedef std::chrono::steady_clock Clock;
+
+std::atomic<bool> traceEnabled(false);
+
+struct TraceEvent
+{
+	const char *category;
+	const char *name;
+	const char *argName;
+	long arg;
+	uint64_t startNanos;		// since startTrace
+	uint64_t durationNanos;
+	int thread;
+};
+
+static vector<TraceEvent> traceEvents;
+static size_t traceMask = 0;					// capacity - 1
+static std::atomic<uint64_t> traceNext(0);		// spans recorded so far
+static std::atomic<int> traceThreads(0);
+static Clock::time_point traceStart;
+static FILE *traceFile = nullptr;
+
+// small thread numbers for the trace, the thread that starts tracing is 0
+static thread_local int traceThread = -1;
+
+/**
+*
+* bool startTrace(const char *path, size_t events)
+*
+* Summary: Starts recording spans
+*
+* Parameters:	char* for the trace file, opened now so a bad path is found
+*				before the game starts
+*				size_t for the spans kept, rounded up to a power of two
+*
+* Returns:	    bool - false if the file can't be opened or tracing has
+*				already started
+*
+**/
+bool startTrace(const char *path, size_t events)
+{
+	if (traceFile) {
+		return false;
+	}
+	traceFile = fopen(path, "w");
+	if (!traceFile) {
+		return false;
+	}
+
+	size_t capacity = 1;
+	while (capacity < events) {
+		capacity *= 2;
+	}
+	// zeroed now, so its pages are touched here rather than while tracing
+	traceEvents.assign(capacity, TraceEvent());
+	traceMask = capacity - 1;
+	traceNext.store(0);
+
+	traceThread = 0;
+	traceThreads.store(1);
+	traceStart = Clock::now();
+	traceEnabled.store(true);
+	return true;
+}
+
+/**
+*
+* void recordTrace(const char *category, const char *name,
+*		const char *argName, long arg, Clock::time_point start)
+*
+* Summary: Adds a span that ends now to the ring buffer
+*
+* Parameters:	char* for the category, such as "render"
+*				char* for the span name
+*				char* for the argument name, or nullptr for none
+*				long for the argument
+*				time_point on the steady clock the span started at
+*
+* Returns:	    void
+*
+* Description: Called by MinesweeperTraceSpan. Any thread may record; each
+*	span takes its own slot, so only the slot counter is shared.
+*
+**/
+void recordTrace(const char *category, const char *name, const char *argName,
+		long arg, Clock::time_point start)
+{
+	Clock::time_point end = Clock::now();
+	if (!traceEnabled.load(std::memory_order_relaxed)) {
+		return;		// stopped while the span was open
+	}
+	if (traceThread < 0) {
+		traceThread = traceThreads.fetch_add(1);
+	}
+
+	TraceEvent &event = traceEvents[
+			traceNext.fetch_add(1, std::memory_order_relaxed) & traceMask];
+	event.category = category;
+	event.name = name;
+	event.argName = argName;
+	event.arg = arg;
+	event.startNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+			start - traceStart).count();
+	event.durationNanos =
+			std::chrono::duration_cast<std::chrono::nanoseconds>(
+			end - start).count();
+	event.thread = traceThread;
+}
+
+/**
+*
+* bool stopTrace()
+*
+* Summary: Stops recording and writes the trace file
+*
+* Parameters:	none
+*
+* Returns:	    bool - false if tracing wasn't started or the file couldn't
+*				be written
+*
+* Description: Call once the other threads that record spans have been
+*	joined. Writes the spans still in the ring, oldest first, as complete
+*	("X") events with times in microseconds, and names each thread:
+*
+*	{"traceEvents": [
+*	  {"name": "thread_name", "ph": "M", "pid": 1, "tid": 0, ...},
+*	  {"name": "key", "cat": "input", "ph": "X", "ts": 1520.250,
+*	   "dur": 35.125, "pid": 1, "tid": 0, "args": {"key": 103}},
+*	  ...],
+*	 "otherData": {"spans": 5120, "dropped": 0}}
+*
+**/
+bool stopTrace()
+{
+	if (!traceFile) {
+		return false;
+	}
+	traceEnabled.store(false);
+
+	uint64_t recorded = traceNext.load();
+	uint64_t capacity = traceMask + 1;
+	uint64_t first = recorded > capacity ? recorded - capacity : 0;
+
+	fprintf(traceFile, "{\"traceEvents\": [\n");
+	int threads = traceThreads.load();
+	for (int t = 0; t < threads; t++) {
+		char threadName[32];
+		if (t == 0) {
+			snprintf(threadName, sizeof(threadName), "main");
+		}
+		else {
+			snprintf(threadName, sizeof(threadName), "thread %d", t);
+		}
+		fprintf(traceFile, "  {\"name\": \"thread_name\", \"ph\": \"M\", "
+				"\"pid\": 1, \"tid\": %d, \"args\": {\"name\": \"%s\"}}%s\n",
+				t, threadName, t + 1 < threads || first < recorded ? "," : "");
+	}
+	for (uint64_t i = first; i < recorded; i++) {
+		const TraceEvent &event = traceEvents[i & traceMask];
+		fprintf(traceFile, "  {\"name\": \"%s\", \"cat\": \"%s\", "
+				"\"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, "
+				"\"tid\": %d", event.name, event.category,
+				event.startNanos / 1000.0, event.durationNanos / 1000.0,
+				event.thread);
+		if (event.argName) {
+			fprintf(traceFile, ", \"args\": {\"%s\": %ld}", event.argName,
+					event.arg);
+		}
+		fprintf(traceFile, "}%s\n", i + 1 < recorded ? "," : "");
+	}
+	fprintf(traceFile, "],\n\"otherData\": {\"spans\": %" PRIu64
+			", \"dropped\": %" PRIu64 "}}\n", recorded, first);
+
+	bool written = fclose(traceFile) == 0;
+	traceFile = nullptr;
+	vector<TraceEvent>().swap(traceEvents);
+	return written;
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* File:		minesweeperTrace.hpp
+* Author:	Kelley Neubauer
+* Date:		10/17/2026
+*
+* Description: Records spans of time (waiting for input, board changes,
+*	solver passes, drawing, timer ticks) in the Chrome trace event format,
+*	which chrome://tracing and ui.perfetto.dev open.
+*
+*	Tracing is switched on at run time by startTrace (minesweeper --trace).
+*	Until then a span is a single relaxed load and a branch. Spans go into
+*	a ring buffer that is allocated and touched when tracing starts, so
+*	recording one is two clock reads and a few stores. When the buffer is
+*	full the oldest spans are overwritten. Nothing is written to the file
+*	until stopTrace.
+*
+*******************************************************************************/
+#ifndef MINESWEEPER_TRACE_HPP
+#define MINESWEEPER_TRACE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>		// size_t
+
+bool startTrace(const char *, size_t);
+bool stopTrace();
+void recordTrace(const char *, const char *, const char *, long,
+		std::chrono::steady_clock::time_point);
+
+// true between startTrace and stopTrace
+extern std::atomic<bool> traceEnabled;
+
+class MinesweeperTraceSpan
+{
+	public:
+		MinesweeperTraceSpan(const char *, const char *,
+				const char * = nullptr, long = 0);
+		~MinesweeperTraceSpan();
+
+	private:
+		const char *category;
+		const char *name;
+		const char *argName;	// nullptr if the span has no argument
+		long arg;
+		bool active;
+		std::chrono::steady_clock::time_point start;
+};
+
+inline MinesweeperTraceSpan::MinesweeperTraceSpan(const char *category,
+		const char *name, const char *argName, long arg)
+{
+	active = traceEnabled.load(std::memory_order_relaxed);
+	if (active) {
+		this->category = category;
+		this->name = name;
+		this->argName = argName;
+		this->arg = arg;
+		start = std::chrono::steady_clock::now();
+	}
+}
+
+inline MinesweeperTraceSpan::~MinesweeperTraceSpan()
+{
+	if (active) {
+		recordTrace(category, name, argName, arg, start);
+	}
+}
+
+// category and name must be string literals, they are kept until the trace
+// is written
+#define TRACE_SPAN(category, name) \
+		MinesweeperTraceSpan traceSpan(category, name)
+#define TRACE_SPAN_ARG(category, name, argName, arg) \
+		MinesweeperTraceSpan traceSpan(category, name, argName, arg)
+
+#endif
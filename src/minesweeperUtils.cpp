@@ -6,23 +6,28 @@
 * Description: This file contains utility functions for minesweeper game
 * 
 *******************************************************************************/
-#include <cstdlib> 	//rand
+#include <chrono>
+#include <random>
+#include "minesweeperUtils.hpp"
 
 /**
 * 
-* int randomNumber(int min, int max)
+* uint64_t randomSeed()
 * 
-* Summary: Generates a random num between min (inclusive) and max (inclusive)
+* Summary: Makes a seed for a new board
 * 
-* Parameters:	an int for min number in range
-* 				an int for max number in range
+* Parameters:	none
 * 				
-* Returns:	    an int
+* Returns:	    uint64_t
 * 
-* Description: Uses seeded rand to generate number. srand should be called 
-*		elsewhere (once in the program) for best results -- e.g. srand(time(0))
+* Description: Mixes the system's random device with a high resolution clock,
+*	so games started in the same second still get different boards. Use a 
+*	fixed seed instead when a game needs to be reproduced.
 * 
 **/
-int randomNumber(int min, int max) {
-	return (rand() % (max - min + 1)) + min;
+uint64_t randomSeed() {
+	std::random_device device;
+	uint64_t seed = ((uint64_t)device() << 32) | device();
+	return seed ^ (uint64_t)std::chrono::high_resolution_clock::now()
+			.time_since_epoch().count();
 }
@@ -6,6 +6,8 @@
 #ifndef MINESWEEPER_UTILS_HPP
 #define MINESWEEPER_UTILS_HPP
 
-int randomNumber(int min, int max);
+#include <cstdint>
 
-#endif
\ No newline at end of file
+uint64_t randomSeed();
+
+#endif